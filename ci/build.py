@@ -38,6 +38,10 @@ def get_matrix() -> List[DeviceConfiguration]:
         if len(split) != 2 or split[0] != 'env':
             continue
 
+        # Host builds like `native` don't produce a firmware image
+        if "board" not in config[section]:
+            continue
+
         board = split[1]
         platform = config[section]["platform"]
         platformio_board = config[section]["board"]
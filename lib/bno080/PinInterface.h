@@ -32,6 +32,8 @@ public:
 	virtual int digitalRead() = 0;
 	virtual void pinMode(uint8_t mode) = 0;
 	virtual void digitalWrite(uint8_t val) = 0;
+	// False when reading the pin is itself a bus transaction (e.g. an IO expander)
+	[[nodiscard]] virtual bool isDirect() const { return false; }
 
 	[[nodiscard]] virtual std::string toString() const = 0;
 };
@@ -23,7 +23,7 @@ namespace I2CSCAN {
 		uint8_t txFails = 0;
     	std::vector<uint8_t> validPorts;
 
-#ifdef ESP8266
+#if defined(ESP8266) || defined(SLIMEVR_NATIVE)
 		std::array<uint8_t, 7> portArray = {16, 5, 4, 2, 14, 12, 13};
 		std::array<std::string, 7> portMap = {"D0", "D1", "D2", "D4", "D5", "D6", "D7"};
 		std::array<uint8_t, 1> portExclude = {LED_PIN};
@@ -10,7 +10,10 @@
 
 #include <stddef.h>
 
+// Follows the precision of the rest of the sensor code (motionprocessing/types.h)
+#if !SENSORS_DOUBLE_PRECISION
 #define VQF_SINGLE_PRECISION
+#endif
 #define M_PI 3.14159265358979323846
 #define M_SQRT2 1.41421356237309504880
 
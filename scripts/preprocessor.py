@@ -108,18 +108,24 @@ def _build_board_flags(defaults: dict, board_name: str) -> List[str]:
 
         for index, sensor in enumerate(sensors):
             if sensor.get('protocol') == 'I2C':
+                wire = [format_value(sensor.get('scl'), 'pin'), format_value(sensor.get('sda'), 'pin')]
+                # Sensors on the second I2C controller are read alongside the first
+                bus = sensor.get('bus', 0)
+                if bus != 0:
+                    wire.append(format_value(bus, 'number'))
                 params = [
                     format_value(sensor.get('imu'), 'raw'),
                     format_value(sensor.get('address', 'PRIMARY_IMU_ADDRESS_ONE' if index == 0 else 'SECONDARY_IMU_ADDRESS_TWO'), 'number'),
                     format_value(sensor.get('rotation'), 'raw'),
-                    f"DIRECT_WIRE({format_value(sensor.get('scl'), 'pin')}, {format_value(sensor.get('sda'), 'pin')})",
+                    f"DIRECT_WIRE({', '.join(wire)})",
                     'false' if index == 0 else 'true',
                     f"DIRECT_PIN({format_value(sensor.get('int', 255), 'pin')})",
                     '0'
                 ]
                 sensor_list.append(f"SENSOR_DESC_ENTRY({','.join(params)})")
-                add('PIN_IMU_SDA', sensor.get('sda'), 'pin')
-                add('PIN_IMU_SCL', sensor.get('scl'), 'pin')
+                if bus == 0:
+                    add('PIN_IMU_SDA', sensor.get('sda'), 'pin')
+                    add('PIN_IMU_SCL', sensor.get('scl'), 'pin')
 
             if sensor.get('protocol') == 'SPI':
                 params = [
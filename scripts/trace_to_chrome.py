@@ -0,0 +1,149 @@
+"""
+Converts a dump of the firmware's TRACE serial command (or of the native
+`run --trace=<file>` tool) to the Chrome trace format, which can be opened in
+chrome://tracing or https://ui.perfetto.dev.
+
+Usage:
+    python scripts/trace_to_chrome.py <capture> <trace.json>
+    python scripts/trace_to_chrome.py --port <serial port> <trace.json>
+
+The capture can be a raw log of the serial port: everything before the dump is
+skipped. With --port the dump is requested from the tracker directly, which
+needs pyserial and tracing to have been started with TRACE ON.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+HEADER = re.compile(rb"TRACE (\d+) (\d+) (\d+)\n")
+FOOTER = b"\nTRACE END\n"
+EVENT = struct.Struct("<IB")
+END_FLAG = 0x80
+ZONE_MASK = 0x1F
+TASK_SHIFT = 5
+TASK_MASK = 0x3
+TASK_NAMES = ["main loop", "sensor reader 0", "sensor reader 1", "task 3"]
+
+
+def read_from_port(port: str, baud: int) -> bytes:
+    import serial
+
+    with serial.Serial(port, baud, timeout=5) as connection:
+        connection.reset_input_buffer()
+        connection.write(b"TRACE DUMP\n")
+        data = connection.read_until(FOOTER)
+    if not data.endswith(FOOTER):
+        sys.exit("Timed out waiting for the trace, was it started with TRACE ON?")
+    return data
+
+
+def parse(data: bytes):
+    headers = list(HEADER.finditer(data))
+    if not headers:
+        sys.exit("No trace found in the capture")
+
+    version, count, zone_count = map(int, headers[-1].groups())
+    if version not in (1, 2):
+        sys.exit(f"Unsupported trace version {version}")
+
+    offset = headers[-1].end()
+    zones = []
+    for _ in range(zone_count):
+        line_end = data.index(b"\n", offset)
+        zones.append(data[offset:line_end].decode())
+        offset = line_end + 1
+
+    events = []
+    for _ in range(count):
+        if offset + EVENT.size > len(data):
+            sys.exit("The trace is truncated")
+        micros, tag = EVENT.unpack_from(data, offset)
+        # Version 1 traces only hold the main loop, with the zone in 7 bits
+        if version == 1:
+            events.append((micros, tag & ~END_FLAG, 0, bool(tag & END_FLAG)))
+        else:
+            zone = tag & ZONE_MASK
+            task = (tag >> TASK_SHIFT) & TASK_MASK
+            events.append((micros, zone, task, bool(tag & END_FLAG)))
+        offset += EVENT.size
+    return zones, events
+
+
+def to_chrome(zones, events):
+    trace = []
+    # Per task, as the sensor readers nest their zones independently
+    open_zones = {}
+    last = None
+    elapsed = 0
+    for micros, zone, task, end in events:
+        # Timestamps are 32 bit and wrap around every ~71 minutes
+        if last is not None:
+            elapsed += (micros - last) & 0xFFFFFFFF
+        last = micros
+
+        name = zones[zone] if zone < len(zones) else f"zone {zone}"
+        task_zones = open_zones.setdefault(task, [])
+        if end:
+            # The ring buffer can start in the middle of a zone
+            if zone not in task_zones:
+                continue
+            while task_zones.pop() != zone:
+                pass
+            phase = "E"
+        else:
+            task_zones.append(zone)
+            phase = "B"
+        trace.append(
+            {"name": name, "ph": phase, "ts": elapsed, "pid": 1, "tid": task + 1}
+        )
+
+    for task, task_zones in open_zones.items():
+        for zone in reversed(task_zones):
+            trace.append(
+                {
+                    "name": zones[zone],
+                    "ph": "E",
+                    "ts": elapsed,
+                    "pid": 1,
+                    "tid": task + 1,
+                }
+            )
+        trace.append(
+            {
+                "name": "thread_name",
+                "ph": "M",
+                "pid": 1,
+                "tid": task + 1,
+                "args": {"name": TASK_NAMES[task]},
+            }
+        )
+    return {"traceEvents": trace, "displayTimeUnit": "ms"}
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="file holding the dump")
+    parser.add_argument("output", help="Chrome trace JSON to write")
+    parser.add_argument("--port", help="serial port of the tracker")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.port:
+        data = read_from_port(args.port, args.baud)
+    elif args.capture:
+        with open(args.capture, "rb") as capture:
+            data = capture.read()
+    else:
+        parser.error("either a capture or --port is needed")
+
+    zones, events = parse(data)
+    with open(args.output, "w") as output:
+        json.dump(to_chrome(zones, events), output)
+    print(f"Wrote {len(events)} events to {args.output}")
+
+
+if __name__ == "__main__":
+    main()
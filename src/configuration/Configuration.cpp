@@ -30,6 +30,7 @@
 
 #include "../FSHelper.h"
 #include "consts.h"
+#include "debugging/Profiler.h"
 #include "sensors/SensorToggles.h"
 #include "utils.h"
 
@@ -108,6 +109,8 @@ void Configuration::setup() {
 }
 
 void Configuration::save() {
+	Debugging::ProfileScope scope{Debugging::ProfileZone::ConfigSave};
+
 	for (size_t i = 0; i < m_Sensors.size(); i++) {
 		SensorConfig config = m_Sensors[i];
 		if (config.type == SensorConfigType::NONE) {
@@ -85,6 +85,11 @@
 #define OPTIMIZE_UPDATES true
 
 #define I2C_SPEED 400000
+// Highest I2C clock tried at startup, on controllers whose sensors all support it
+// and keep answering correctly. Set to I2C_SPEED to always run at I2C_SPEED.
+#ifndef I2C_FAST_SPEED
+#define I2C_FAST_SPEED 1000000
+#endif
 
 #define COMPLIANCE_MODE true
 #define USE_ATTENUATION COMPLIANCE_MODE&& ESP8266
@@ -96,6 +101,17 @@
 // Not recommended for production
 #define ENABLE_INSPECTION false
 
+// Send the metrics to servers advertising PROTOCOL_TELEMETRY_SUPPORT, in
+// PACKET_TELEMETRY 106. The server doesn't define that flag or packet id yet, so
+// only the native build, whose mock server speaks them, opts in for now.
+#ifndef ENABLE_TELEMETRY
+#ifdef SLIMEVR_NATIVE
+#define ENABLE_TELEMETRY true
+#else
+#define ENABLE_TELEMETRY false
+#endif
+#endif
+
 #define PROTOCOL_VERSION 22
 
 #ifndef FIRMWARE_VERSION
@@ -106,10 +122,40 @@
 #define USE_RUNTIME_CALIBRATION true
 #endif
 
-#define DEBUG_MEASURE_SENSOR_TIME_TAKEN false
+// Records every register read of one IMU to LittleFS (/imurec) for replay with
+// the `replay` tool of the native build. Flash writes stall the sensor loop, so
+// only enable this to capture a problem.
+#ifndef DEBUG_RECORD_IMU
+#define DEBUG_RECORD_IMU false
+#endif
+
+#ifndef DEBUG_RECORD_IMU_SENSOR_ID
+#define DEBUG_RECORD_IMU_SENSOR_ID 0
+#endif
+
+#ifndef DEBUG_RECORD_IMU_MAX_BYTES
+#define DEBUG_RECORD_IMU_MAX_BYTES (256 * 1024)
+#endif
+
+// Events kept by the TRACE serial command, 8 bytes each. The buffer is only
+// allocated once tracing starts.
+#ifndef DEBUG_TRACE_EVENTS
+#define DEBUG_TRACE_EVENTS 512
+#endif
 
-#ifndef DEBUG_MEASURE_SENSOR_TIME_TAKEN
-#define DEBUG_MEASURE_SENSOR_TIME_TAKEN false
+// Reads the FIFO of the next sensor on a second core while the current one runs
+// its fusion. The native build has it too, so the benchmarks can show its effect.
+// Single core ESP32s (C3, S2, C6) have no core to run it on.
+#ifdef ESP32
+#include <sdkconfig.h>
+#endif
+
+#ifndef USE_OVERLAPPED_SENSOR_READS
+#if (defined(ESP32) && !CONFIG_FREERTOS_UNICORE) || defined(SLIMEVR_NATIVE)
+#define USE_OVERLAPPED_SENSOR_READS true
+#else
+#define USE_OVERLAPPED_SENSOR_READS false
+#endif
 #endif
 
 #ifndef USE_OTA_TIMEOUT
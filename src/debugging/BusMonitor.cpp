@@ -0,0 +1,142 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "BusMonitor.h"
+
+#include <iterator>
+
+#include "Metrics.h"
+#include "debug.h"
+
+#define BUS_MONITOR_WINDOW_MICROS 1000000UL
+
+namespace SlimeVR::Debugging {
+
+BusMonitor busMonitor;
+
+namespace {
+
+const char* const BusNames[] = {
+	"i2c",
+	"spi",
+	"i2c1",
+};
+
+static_assert(std::size(BusNames) == static_cast<size_t>(Bus::Count));
+
+// Bits on the wire per payload byte: I2C acknowledges each byte
+const uint8_t BitsPerByte[] = {
+	9,
+	8,
+	9,
+};
+
+const Gauge LoadGauges[] = {
+	Gauge::I2CLoad,
+	Gauge::SPILoad,
+	Gauge::I2C1Load,
+};
+
+}  // namespace
+
+BusMonitor::BusMonitor() {
+	setClock(Bus::I2C, I2C_SPEED);
+	setClock(Bus::I2C1, I2C_SPEED);
+}
+
+void BusMonitor::setEnabled(bool enabled) {
+	if (enabled && !m_Enabled) {
+		for (auto& bus : m_Buses) {
+			bus.transactions = 0;
+			bus.bytes = 0;
+			bus.busyMicros = 0;
+			bus.usage = {};
+		}
+		m_WindowStartMicros = micros();
+	}
+	m_Enabled = enabled;
+}
+
+void BusMonitor::update() {
+	if (!m_Enabled) {
+		return;
+	}
+
+	const uint32_t now = micros();
+	const uint32_t elapsed = now - m_WindowStartMicros;
+	if (elapsed < BUS_MONITOR_WINDOW_MICROS) {
+		return;
+	}
+	m_WindowStartMicros = now;
+
+	const float seconds = elapsed / 1e6f;
+	for (size_t i = 0; i < static_cast<size_t>(Bus::Count); i++) {
+		auto& bus = m_Buses[i];
+		bus.usage = {
+			.transactionsPerSecond = bus.transactions / seconds,
+			.bytesPerSecond = bus.bytes / seconds,
+			.busy = static_cast<float>(bus.busyMicros) / elapsed,
+		};
+		bus.transactions = 0;
+		bus.bytes = 0;
+		bus.busyMicros = 0;
+
+		metrics.set(LoadGauges[i], bus.usage.busy * 100);
+	}
+}
+
+void BusMonitor::print() const {
+	m_Logger.info(
+		"%-4s %8s %8s %9s %6s %10s %9s",
+		"bus",
+		"clock",
+		"trans/s",
+		"bytes/s",
+		"busy",
+		"spare B/s",
+		"wire B/s"
+	);
+	for (size_t i = 0; i < static_cast<size_t>(Bus::Count); i++) {
+		const auto& bus = m_Buses[i];
+		const auto& usage = bus.usage;
+		if (usage.transactionsPerSecond == 0) {
+			continue;
+		}
+		// Payload the idle time could still carry with the same mix of
+		// transactions, next to the limit of the clock itself
+		const float spare
+			= usage.busy > 0 ? usage.bytesPerSecond / usage.busy * (1 - usage.busy) : 0;
+		m_Logger.info(
+			"%-4s %7luk %8.0f %9.0f %5.1f%% %10.0f %9.0f",
+			BusNames[i],
+			static_cast<unsigned long>(bus.clockHz / 1000),
+			usage.transactionsPerSecond,
+			usage.bytesPerSecond,
+			usage.busy * 100,
+			spare,
+			static_cast<float>(bus.clockHz) / BitsPerByte[i]
+		);
+	}
+}
+
+}  // namespace SlimeVR::Debugging
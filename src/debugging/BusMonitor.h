@@ -0,0 +1,134 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "logging/Logger.h"
+
+namespace SlimeVR::Debugging {
+
+enum class Bus : uint8_t {
+	I2C,
+	SPI,
+	// Second I2C controller, Wire1
+	I2C1,
+	Count,
+};
+
+constexpr Bus i2cBus(uint8_t controller) {
+	return controller == 0 ? Bus::I2C : Bus::I2C1;
+}
+
+/*
+ * How busy the sensor buses are: transactions, payload bytes and time spent in
+ * them, over windows of one second. Compared to what the bus clock allows, it
+ * tells how many more IMUs a bus can carry. Off until enabled at runtime (the
+ * GET BUS serial command), so transactions only pay for a branch until then.
+ *
+ * Usage, around a transaction:
+ *
+ * BusScope scope{Bus::I2C, size};
+ */
+class BusMonitor {
+public:
+	struct Usage {
+		float transactionsPerSecond = 0;
+		float bytesPerSecond = 0;
+		// Fraction of the time spent in transactions
+		float busy = 0;
+	};
+
+	BusMonitor();
+
+	// Starts a fresh window when enabled
+	void setEnabled(bool enabled);
+	[[nodiscard]] bool isEnabled() const { return m_Enabled; }
+
+	void setClock(Bus bus, uint32_t hz) { stats(bus).clockHz = hz; }
+	void record(Bus bus, uint32_t bytes, uint32_t micros) {
+		auto& window = stats(bus);
+		window.transactions++;
+		window.bytes += bytes;
+		window.busyMicros += micros;
+	}
+
+	// Closes the window once a second and updates the load gauges
+	void update();
+	[[nodiscard]] const Usage& getUsage(Bus bus) const {
+		return m_Buses[static_cast<size_t>(bus)].usage;
+	}
+	// Logs the usage of the last window and the headroom left
+	void print() const;
+
+private:
+	struct BusStats {
+		uint32_t clockHz = 0;
+		uint32_t transactions = 0;
+		uint32_t bytes = 0;
+		uint32_t busyMicros = 0;
+		Usage usage;
+	};
+
+	BusStats& stats(Bus bus) { return m_Buses[static_cast<size_t>(bus)]; }
+
+	bool m_Enabled = false;
+	BusStats m_Buses[static_cast<size_t>(Bus::Count)];
+	uint32_t m_WindowStartMicros = 0;
+
+	SlimeVR::Logging::Logger m_Logger = SlimeVR::Logging::Logger("BusMonitor");
+};
+
+extern BusMonitor busMonitor;
+
+class BusScope {
+public:
+	BusScope(Bus bus, uint32_t bytes)
+		: m_Bus(bus)
+		, m_Bytes(bytes) {
+		if (busMonitor.isEnabled()) {
+			m_Active = true;
+			m_StartMicros = micros();
+		}
+	}
+	~BusScope() {
+		if (m_Active) {
+			busMonitor.record(m_Bus, m_Bytes, micros() - m_StartMicros);
+		}
+	}
+
+	BusScope(const BusScope&) = delete;
+	BusScope& operator=(const BusScope&) = delete;
+
+private:
+	Bus m_Bus;
+	bool m_Active = false;
+	uint32_t m_Bytes;
+	uint32_t m_StartMicros = 0;
+};
+
+}  // namespace SlimeVR::Debugging
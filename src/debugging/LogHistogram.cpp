@@ -0,0 +1,86 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "LogHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SlimeVR::Debugging {
+
+void LogHistogram::record(uint32_t micros) {
+	m_Min = m_Count == 0 ? micros : std::min(m_Min, micros);
+	m_Max = std::max(m_Max, micros);
+	m_Count++;
+	m_Total += micros;
+
+	auto& count = m_Buckets[bucket(micros)];
+	if (count == UINT16_MAX) {
+		for (auto& other : m_Buckets) {
+			other /= 2;
+		}
+	}
+	count++;
+}
+
+void LogHistogram::reset() { *this = LogHistogram{}; }
+
+uint32_t LogHistogram::percentile(float fraction) const {
+	uint32_t samples = 0;
+	for (auto count : m_Buckets) {
+		samples += count;
+	}
+
+	const auto rank = static_cast<uint32_t>(std::ceil(samples * fraction));
+	uint32_t seen = 0;
+	for (size_t i = 0; i < Buckets; i++) {
+		seen += m_Buckets[i];
+		if (seen >= rank) {
+			return std::min(bucketTop(i), m_Max);
+		}
+	}
+	return m_Max;
+}
+
+size_t LogHistogram::bucket(uint32_t micros) {
+	if (micros == 0) {
+		return 0;
+	}
+	const int octave = 31 - __builtin_clz(micros);
+	const int half = octave == 0 ? 0 : (micros >> (octave - 1)) & 1;
+	return std::min<size_t>(1 + 2 * octave + half, Buckets - 1);
+}
+
+uint32_t LogHistogram::bucketTop(size_t bucket) {
+	if (bucket == 0) {
+		return 0;
+	}
+	const int octave = (bucket - 1) / 2;
+	const int half = (bucket - 1) % 2;
+	if (octave == 0) {
+		return 1;
+	}
+	return (1u << octave) + ((half + 1u) << (octave - 1)) - 1;
+}
+
+}  // namespace SlimeVR::Debugging
@@ -0,0 +1,62 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SlimeVR::Debugging {
+
+// Distribution of durations in microseconds, counted in buckets two per power of
+// two up to 1s, so percentiles are at most 50% above the real value. The bucket
+// counts are 16 bits: when one fills up they are all halved, which keeps the
+// shape of the distribution.
+class LogHistogram {
+public:
+	void record(uint32_t micros);
+	void reset();
+
+	[[nodiscard]] uint32_t percentile(float fraction) const;
+	[[nodiscard]] uint32_t count() const { return m_Count; }
+	[[nodiscard]] uint32_t min() const { return m_Min; }
+	[[nodiscard]] uint32_t max() const { return m_Max; }
+	[[nodiscard]] uint64_t total() const { return m_Total; }
+	[[nodiscard]] float mean() const {
+		return m_Count == 0 ? 0 : static_cast<float>(m_Total) / m_Count;
+	}
+
+private:
+	static constexpr size_t Buckets = 43;
+
+	static size_t bucket(uint32_t micros);
+	static uint32_t bucketTop(size_t bucket);
+
+	uint16_t m_Buckets[Buckets] = {};
+	uint32_t m_Count = 0;
+	uint32_t m_Min = 0;
+	uint32_t m_Max = 0;
+	uint64_t m_Total = 0;
+};
+
+}  // namespace SlimeVR::Debugging
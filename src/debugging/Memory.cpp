@@ -0,0 +1,101 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "Memory.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+
+#include "Metrics.h"
+
+#define MEMORY_UPDATE_INTERVAL 5000UL
+
+namespace SlimeVR::Debugging {
+
+MemoryMonitor memoryMonitor;
+
+MemoryUsage MemoryUsage::measure() {
+#if ESP32
+	return {
+		.freeHeap = ESP.getFreeHeap(),
+		.largestFreeBlock = ESP.getMaxAllocHeap(),
+		.freeStack = uxTaskGetStackHighWaterMark(nullptr),
+	};
+#else
+	return {
+		.freeHeap = ESP.getFreeHeap(),
+		.largestFreeBlock = ESP.getMaxFreeBlockSize(),
+		.freeStack = ESP.getFreeContStack(),
+	};
+#endif
+}
+
+void MemoryMonitor::markStage(const char* stage) {
+	const auto usage = MemoryUsage::measure();
+	updateGauges(usage);
+
+	if (m_StageCount == MaxStages) {
+		m_Logger.warn("Too many boot stages, %s isn't recorded", stage);
+		return;
+	}
+	m_Stages[m_StageCount++] = {stage, usage};
+}
+
+void MemoryMonitor::update() {
+	if (millis() - m_LastUpdateMillis < MEMORY_UPDATE_INTERVAL) {
+		return;
+	}
+	m_LastUpdateMillis = millis();
+
+	updateGauges(MemoryUsage::measure());
+}
+
+void MemoryMonitor::updateGauges(const MemoryUsage& usage) {
+	m_MinFreeHeap = std::min(m_MinFreeHeap, usage.freeHeap);
+
+	metrics.set(Gauge::FreeHeap, usage.freeHeap);
+	metrics.set(Gauge::MinFreeHeap, m_MinFreeHeap);
+	metrics.set(Gauge::LargestFreeBlock, usage.largestFreeBlock);
+	metrics.set(Gauge::FreeStack, usage.freeStack);
+}
+
+void MemoryMonitor::print() const {
+	m_Logger.info("%-14s %10s %10s %10s", "stage (bytes)", "heap", "block", "stack");
+	auto printUsage = [&](const char* name, const MemoryUsage& usage) {
+		m_Logger.info(
+			"%-14s %10lu %10lu %10lu",
+			name,
+			static_cast<unsigned long>(usage.freeHeap),
+			static_cast<unsigned long>(usage.largestFreeBlock),
+			static_cast<unsigned long>(usage.freeStack)
+		);
+	};
+	for (size_t i = 0; i < m_StageCount; i++) {
+		printUsage(m_Stages[i].name, m_Stages[i].usage);
+	}
+	printUsage("now", MemoryUsage::measure());
+	m_Logger.info("Lowest free heap: %lu", static_cast<unsigned long>(m_MinFreeHeap));
+}
+
+}  // namespace SlimeVR::Debugging
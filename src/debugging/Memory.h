@@ -0,0 +1,74 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "logging/Logger.h"
+
+namespace SlimeVR::Debugging {
+
+struct MemoryUsage {
+	uint32_t freeHeap = 0;
+	// Biggest allocation that can still succeed, lower than freeHeap when the heap
+	// is fragmented
+	uint32_t largestFreeBlock = 0;
+	// Stack the loop task has never used since boot
+	uint32_t freeStack = 0;
+
+	static MemoryUsage measure();
+};
+
+// Memory left after each stage of setup(), to catch allocations that grew, and
+// the memory gauges of the metrics while running
+class MemoryMonitor {
+public:
+	// Call once a stage of the boot is done, with a string literal
+	void markStage(const char* stage);
+	// Refreshes the gauges every few seconds
+	void update();
+	void print() const;
+
+private:
+	static constexpr size_t MaxStages = 8;
+
+	struct Stage {
+		const char* name;
+		MemoryUsage usage;
+	};
+
+	void updateGauges(const MemoryUsage& usage);
+
+	Stage m_Stages[MaxStages] = {};
+	size_t m_StageCount = 0;
+	uint32_t m_MinFreeHeap = UINT32_MAX;
+	unsigned long m_LastUpdateMillis = 0;
+
+	SlimeVR::Logging::Logger m_Logger = SlimeVR::Logging::Logger("Memory");
+};
+
+extern MemoryMonitor memoryMonitor;
+
+}  // namespace SlimeVR::Debugging
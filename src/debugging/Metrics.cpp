@@ -0,0 +1,82 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "Metrics.h"
+
+#include <iterator>
+
+namespace SlimeVR::Debugging {
+
+Metrics metrics;
+
+namespace {
+
+const char* const CounterNames[] = {
+	"fifo overwhelmed",
+	"fifo overruns",
+	"i2c read errors",
+	"i2c timeouts",
+	"udp send failures",
+	"bundle overflows",
+	"sensor timeouts",
+	"wifi reconnects",
+	"server timeouts",
+	"fifo interrupt timeouts",
+	"i2c clock fallbacks",
+};
+
+const char* const GaugeNames[] = {
+	"loop rate",
+	"signal strength",
+	"free heap",
+	"min free heap",
+	"largest free block",
+	"free stack",
+	"i2c load",
+	"spi load",
+	"i2c1 load",
+};
+
+const char* const HistogramNames[] = {
+	"loop period",
+};
+
+static_assert(std::size(CounterNames) == Metrics::CounterCount);
+static_assert(std::size(GaugeNames) == Metrics::GaugeCount);
+static_assert(std::size(HistogramNames) == Metrics::HistogramCount);
+
+}  // namespace
+
+const char* Metrics::name(Counter counter) {
+	return CounterNames[static_cast<size_t>(counter)];
+}
+
+const char* Metrics::name(Gauge gauge) {
+	return GaugeNames[static_cast<size_t>(gauge)];
+}
+
+const char* Metrics::name(Histogram histogram) {
+	return HistogramNames[static_cast<size_t>(histogram)];
+}
+
+}  // namespace SlimeVR::Debugging
@@ -0,0 +1,126 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "LogHistogram.h"
+#include "debug.h"
+
+namespace SlimeVR::Debugging {
+
+// Things going wrong that would otherwise only show as jitter. The telemetry
+// packet sends them in this order, so new ones go at the end.
+enum class Counter : uint8_t {
+	// bulkRead() left data in the FIFO
+	FifoOverwhelmed,
+	// The IMU reported its FIFO overran and lost samples
+	FifoOverruns,
+	I2CReadErrors,
+	I2CTimeouts,
+	UdpSendFailures,
+	// Packets dropped from a bundle that had no room left for them
+	BundleOverflows,
+	SensorTimeouts,
+	WiFiReconnects,
+	ServerTimeouts,
+	// The FIFO watermark interrupt never fired, polling was used instead
+	FifoInterruptTimeouts,
+	// A raised I2C clock went back to I2C_SPEED, see I2CClock
+	I2CClockFallbacks,
+	Count,
+};
+
+enum class Gauge : uint8_t {
+	LoopRate,
+	SignalStrength,
+	// In bytes, see MemoryMonitor
+	FreeHeap,
+	MinFreeHeap,
+	LargestFreeBlock,
+	FreeStack,
+	// Percentage of the time spent in transactions, see BusMonitor
+	I2CLoad,
+	SPILoad,
+	I2C1Load,
+	Count,
+};
+
+// Distributions of durations, in microseconds
+enum class Histogram : uint8_t {
+	LoopPeriod,
+	Count,
+};
+
+// Counters only ever go up, from boot, gauges hold the last value set and
+// histograms are reset by whoever reports them
+class Metrics {
+public:
+	static constexpr size_t CounterCount = static_cast<size_t>(Counter::Count);
+	static constexpr size_t GaugeCount = static_cast<size_t>(Gauge::Count);
+	static constexpr size_t HistogramCount = static_cast<size_t>(Histogram::Count);
+
+	void increment(Counter counter) {
+		auto& value = m_Counters[static_cast<size_t>(counter)];
+#if USE_OVERLAPPED_SENSOR_READS
+		value.fetch_add(1, std::memory_order_relaxed);
+#else
+		value++;
+#endif
+	}
+	void set(Gauge gauge, float value) { m_Gauges[static_cast<size_t>(gauge)] = value; }
+	void record(Histogram histogram, uint32_t micros) {
+		m_Histograms[static_cast<size_t>(histogram)].record(micros);
+	}
+
+	[[nodiscard]] uint32_t get(Counter counter) const {
+		return m_Counters[static_cast<size_t>(counter)];
+	}
+	[[nodiscard]] float get(Gauge gauge) const {
+		return m_Gauges[static_cast<size_t>(gauge)];
+	}
+	[[nodiscard]] LogHistogram& get(Histogram histogram) {
+		return m_Histograms[static_cast<size_t>(histogram)];
+	}
+
+	static const char* name(Counter counter);
+	static const char* name(Gauge gauge);
+	static const char* name(Histogram histogram);
+
+private:
+	// The sensor readers count bus errors and FIFO overruns too
+#if USE_OVERLAPPED_SENSOR_READS
+	std::atomic<uint32_t> m_Counters[CounterCount] = {};
+#else
+	uint32_t m_Counters[CounterCount] = {};
+#endif
+	float m_Gauges[GaugeCount] = {};
+	LogHistogram m_Histograms[HistogramCount];
+};
+
+extern Metrics metrics;
+
+}  // namespace SlimeVR::Debugging
@@ -0,0 +1,174 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "Profiler.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace SlimeVR::Debugging {
+
+#if USE_OVERLAPPED_SENSOR_READS
+thread_local uint8_t profileTask = 0;
+#endif
+
+Profiler profiler;
+
+namespace {
+
+const char* const ZoneNames[] = {
+	"loop",
+	"network",
+	"wifi upkeep",
+	"sensors",
+	"fifo parse",
+	"bus read",
+	"calibration",
+	"fusion",
+	"packet build",
+	"udp send",
+	"config save",
+};
+
+static_assert(std::size(ZoneNames) == static_cast<size_t>(ProfileZone::Count));
+
+}  // namespace
+
+void Profiler::setEnabled(bool enabled) {
+	if (enabled && !m_Enabled) {
+		reset();
+	}
+	m_Enabled = enabled;
+}
+
+void Profiler::reset() {
+	for (auto& task : m_Tasks) {
+		for (auto& zone : task.zones) {
+			zone = ZoneStats{};
+		}
+	}
+	m_StartMicros = micros();
+}
+
+const char* Profiler::zoneName(ProfileZone zone) {
+	return ZoneNames[static_cast<size_t>(zone)];
+}
+
+void Profiler::enter(ProfileScope& scope) {
+	auto& task = m_Tasks[profileTask];
+	auto& zone = task.zones[static_cast<size_t>(scope.m_Zone)];
+	if (zone.parent == NoParent && task.current != nullptr) {
+		zone.parent = static_cast<uint8_t>(task.current->m_Zone);
+	}
+
+	scope.m_Active = true;
+	scope.m_Previous = task.current;
+	task.current = &scope;
+	scope.m_StartMicros = micros();
+}
+
+void Profiler::exit(ProfileScope& scope) {
+	const uint32_t elapsed = micros() - scope.m_StartMicros;
+	auto& task = m_Tasks[profileTask];
+	task.current = scope.m_Previous;
+	if (task.current != nullptr) {
+		task.current->m_ChildMicros += elapsed;
+	}
+
+	auto& zone = task.zones[static_cast<size_t>(scope.m_Zone)];
+	zone.durations.record(elapsed);
+	zone.selfMicros += elapsed - std::min(elapsed, scope.m_ChildMicros);
+}
+
+void Profiler::print() const {
+	const float periodMicros = micros() - m_StartMicros;
+	m_Logger.info(
+		"%-18s %8s %6s %7s %7s %7s %6s %6s",
+		"zone (us)",
+		"count",
+		"min",
+		"avg",
+		"max",
+		"p99",
+		"time",
+		"self"
+	);
+	for (uint8_t t = 0; t < MaxProfileTasks; t++) {
+		const auto& task = m_Tasks[t];
+		if (t > 0) {
+			const bool recorded = std::any_of(
+				std::begin(task.zones),
+				std::end(task.zones),
+				[](const ZoneStats& zone) { return zone.durations.count() > 0; }
+			);
+			if (!recorded) {
+				continue;
+			}
+			m_Logger.info("sensor reader %d:", t - 1);
+		}
+		for (size_t i = 0; i < static_cast<size_t>(ProfileZone::Count); i++) {
+			if (task.zones[i].parent == NoParent) {
+				printZone(task, i, 0, periodMicros);
+			}
+		}
+	}
+	m_Logger.info("Over %.1fs", periodMicros / 1e6f);
+}
+
+void Profiler::printZone(
+	const TaskStats& task,
+	uint8_t index,
+	int depth,
+	float periodMicros
+) const {
+	const auto& zone = task.zones[index];
+	const auto& durations = zone.durations;
+	if (durations.count() == 0) {
+		return;
+	}
+
+	m_Logger.info(
+		"%*s%-*s %8lu %6lu %7.1f %7lu %7lu %5.1f%% %5.1f%%",
+		depth * 2,
+		"",
+		18 - depth * 2,
+		ZoneNames[index],
+		static_cast<unsigned long>(durations.count()),
+		static_cast<unsigned long>(durations.min()),
+		durations.mean(),
+		static_cast<unsigned long>(durations.max()),
+		static_cast<unsigned long>(durations.percentile(0.99f)),
+		durations.total() / periodMicros * 100,
+		zone.selfMicros / periodMicros * 100
+	);
+
+	for (size_t i = 0; i < static_cast<size_t>(ProfileZone::Count); i++) {
+		if (task.zones[i].parent == index) {
+			printZone(task, i, depth + 1, periodMicros);
+		}
+	}
+}
+
+}  // namespace SlimeVR::Debugging
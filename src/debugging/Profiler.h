@@ -0,0 +1,160 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "LogHistogram.h"
+#include "Tracer.h"
+#include "debug.h"
+#include "logging/Logger.h"
+
+namespace SlimeVR::Debugging {
+
+// The main loop and a sensor reader per I2C controller
+constexpr uint8_t MaxProfileTasks = USE_OVERLAPPED_SENSOR_READS ? 3 : 1;
+
+// Which task scopes are recorded under: 0 for the main loop, 1 + the controller
+// for a sensor reader
+#if USE_OVERLAPPED_SENSOR_READS
+extern thread_local uint8_t profileTask;
+#else
+constexpr uint8_t profileTask = 0;
+#endif
+
+enum class ProfileZone : uint8_t {
+	Loop,
+	Network,
+	WiFiUpkeep,
+	Sensors,
+	FifoParse,
+	BusRead,
+	Calibration,
+	Fusion,
+	PacketBuild,
+	UdpSend,
+	ConfigSave,
+	Count,
+};
+
+class ProfileScope;
+
+/*
+ * Time spent in named zones of the firmware, off until enabled at runtime (the
+ * PROF serial command). Zones nest: each one also knows how much of its time
+ * was spent outside of the zones inside it, and is printed under the zone it
+ * was first entered from. Each task has a table of its own, so the bus reads
+ * of the sensor readers are printed apart from the main loop. While tracing,
+ * every enter and exit is also recorded in the tracer.
+ *
+ * Usage:
+ *
+ * {
+ *     ProfileScope scope{ProfileZone::Fusion};
+ *     thing to measure
+ * }
+ */
+class Profiler {
+public:
+	void setEnabled(bool enabled);
+	[[nodiscard]] bool isEnabled() const { return m_Enabled; }
+	void reset();
+	// Logs the statistics gathered since the last reset
+	void print() const;
+
+	static const char* zoneName(ProfileZone zone);
+
+private:
+	friend class ProfileScope;
+
+	static constexpr uint8_t NoParent = 0xff;
+
+	struct ZoneStats {
+		LogHistogram durations;
+		uint64_t selfMicros = 0;
+		uint8_t parent = NoParent;
+	};
+
+	// Only touched by its own task, apart from reset() and print() which don't
+	// lock, so a reader's numbers can be off by the burst in progress
+	struct TaskStats {
+		ProfileScope* current = nullptr;
+		ZoneStats zones[static_cast<size_t>(ProfileZone::Count)];
+	};
+
+	void enter(ProfileScope& scope);
+	void exit(ProfileScope& scope);
+	void printZone(
+		const TaskStats& task,
+		uint8_t zone,
+		int depth,
+		float periodMicros
+	) const;
+
+	bool m_Enabled = false;
+	uint32_t m_StartMicros = 0;
+	TaskStats m_Tasks[MaxProfileTasks];
+
+	SlimeVR::Logging::Logger m_Logger = SlimeVR::Logging::Logger("Profiler");
+};
+
+extern Profiler profiler;
+
+class ProfileScope {
+public:
+	explicit ProfileScope(ProfileZone zone)
+		: m_Zone(zone) {
+		if (profiler.isEnabled()) {
+			profiler.enter(*this);
+		}
+		if (tracer.isEnabled()) {
+			m_Traced = true;
+			tracer.record(zone, profileTask, false);
+		}
+	}
+	~ProfileScope() {
+		if (m_Traced && tracer.isEnabled()) {
+			tracer.record(m_Zone, profileTask, true);
+		}
+		if (m_Active) {
+			profiler.exit(*this);
+		}
+	}
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	friend class Profiler;
+
+	ProfileZone m_Zone;
+	bool m_Active = false;
+	bool m_Traced = false;
+	uint32_t m_StartMicros = 0;
+	uint32_t m_ChildMicros = 0;
+	ProfileScope* m_Previous = nullptr;
+};
+
+}  // namespace SlimeVR::Debugging
@@ -0,0 +1,81 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "Tracer.h"
+
+#include <algorithm>
+#include <new>
+
+#include "Profiler.h"
+
+namespace SlimeVR::Debugging {
+
+Tracer tracer;
+
+// Both fit their bits of the event tag, see record()
+static_assert(static_cast<size_t>(ProfileZone::Count) <= 1 << 5);
+static_assert(MaxProfileTasks <= 1 << 2);
+
+bool Tracer::start() {
+	if (!m_Events) {
+		m_Events.reset(new (std::nothrow) Event[Size]);
+		if (!m_Events) {
+			return false;
+		}
+	}
+	m_Written = 0;
+	m_Enabled = true;
+	return true;
+}
+
+void Tracer::dump(Print& output) {
+	stop();
+
+	const uint32_t written = m_Written;
+	const uint32_t count = std::min<uint32_t>(written, Size);
+	const auto zoneCount = static_cast<uint8_t>(ProfileZone::Count);
+	output.printf(
+		"TRACE %u %lu %u\n",
+		Version,
+		static_cast<unsigned long>(count),
+		zoneCount
+	);
+	for (uint8_t i = 0; i < zoneCount; i++) {
+		output.printf("%s\n", Profiler::zoneName(static_cast<ProfileZone>(i)));
+	}
+
+	for (uint32_t i = written - count; i != written; i++) {
+		const auto& event = m_Events[i % Size];
+		const uint8_t bytes[] = {
+			static_cast<uint8_t>(event.micros),
+			static_cast<uint8_t>(event.micros >> 8),
+			static_cast<uint8_t>(event.micros >> 16),
+			static_cast<uint8_t>(event.micros >> 24),
+			event.tag,
+		};
+		output.write(bytes, sizeof(bytes));
+	}
+	output.printf("\nTRACE END\n");
+}
+
+}  // namespace SlimeVR::Debugging
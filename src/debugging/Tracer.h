@@ -0,0 +1,93 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "debug.h"
+
+namespace SlimeVR::Debugging {
+
+enum class ProfileZone : uint8_t;
+
+/*
+ * Timeline of profiler zones being entered and exited, for seeing how the
+ * sensors, the bus and the network get in each other's way. Off until started
+ * at runtime (the TRACE serial command), it then keeps the last
+ * DEBUG_TRACE_EVENTS events in a ring buffer.
+ *
+ * The sensor readers record too, each event tagged with its task, and claim
+ * their slot atomically. scripts/trace_to_chrome.py turns a dump into a Chrome
+ * trace with a track per task.
+ */
+class Tracer {
+public:
+	// Forgets earlier events, fails if there is no memory left for the buffer
+	bool start();
+	void stop() { m_Enabled = false; }
+	[[nodiscard]] bool isEnabled() const { return m_Enabled; }
+
+	void record(ProfileZone zone, uint8_t task, bool end) {
+		auto& event = m_Events[m_Written++ % Size];
+		event.micros = micros();
+		event.tag = static_cast<uint8_t>(zone) | (task << TaskShift)
+				  | (end ? EndFlag : 0);
+	}
+
+	// Stops recording and writes the events, oldest first:
+	// "TRACE <version> <events> <zones>\n", one zone name per line, each event
+	// as its u32 little endian timestamp and u8 tag (zone in the low 5 bits, task
+	// in the next 2, high bit set when exiting), then "\nTRACE END\n"
+	void dump(Print& output);
+
+private:
+	static constexpr size_t Size = DEBUG_TRACE_EVENTS;
+	static constexpr uint8_t TaskShift = 5;
+	static constexpr uint8_t EndFlag = 0x80;
+	static constexpr uint8_t Version = 2;
+
+	static_assert((Size & (Size - 1)) == 0, "DEBUG_TRACE_EVENTS must be a power of 2");
+
+	struct Event {
+		uint32_t micros;
+		uint8_t tag;
+	};
+
+	bool m_Enabled = false;
+#if USE_OVERLAPPED_SENSOR_READS
+	std::atomic<uint32_t> m_Written = 0;
+#else
+	uint32_t m_Written = 0;
+#endif
+	std::unique_ptr<Event[]> m_Events;
+};
+
+extern Tracer tracer;
+
+}  // namespace SlimeVR::Debugging
@@ -27,7 +27,9 @@
 #include "Wire.h"
 #include "batterymonitor.h"
 #include "credentials.h"
-#include "debugging/TimeTaken.h"
+#include "debugging/Memory.h"
+#include "debugging/Metrics.h"
+#include "debugging/Profiler.h"
 #include "globals.h"
 #include "logging/Logger.h"
 #include "ota.h"
@@ -45,10 +47,6 @@ SlimeVR::Network::Connection networkConnection;
 SlimeVR::WiFiNetwork wifiNetwork;
 SlimeVR::WifiProvisioning wifiProvisioning;
 
-#if DEBUG_MEASURE_SENSOR_TIME_TAKEN
-SlimeVR::Debugging::TimeTakenMeasurer sensorMeasurer{"Sensors"};
-#endif
-
 int sensorToCalibrate = -1;
 bool blinking = false;
 unsigned long blinkStart = 0;
@@ -67,6 +65,7 @@ void setup() {
 	Serial.println();
 
 	logger.info("SlimeVR v" FIRMWARE_VERSION " starting up...");
+	SlimeVR::Debugging::memoryMonitor.markStage("boot");
 
 	char vendorBuffer[512];
 	size_t writtenLength;
@@ -104,6 +103,7 @@ void setup() {
 
 	ledManager.setup();
 	configuration.setup();
+	SlimeVR::Debugging::memoryMonitor.markStage("configuration");
 
 	SerialCommands::setUp();
 	// Make sure the bus isn't stuck when resetting ESP without powering it down
@@ -139,33 +139,48 @@ void setup() {
 	delay(500);
 
 	sensorManager.setup();
+	SlimeVR::Debugging::memoryMonitor.markStage("sensors");
 
 	networkManager.setup();
 	OTA::otaSetup(otaPassword);
 	battery.Setup();
+	SlimeVR::Debugging::memoryMonitor.markStage("network");
 
 	statusManager.setStatus(SlimeVR::Status::LOADING, false);
 
 	sensorManager.postSetup();
+	SlimeVR::Debugging::memoryMonitor.markStage("post setup");
 
 	loopTime = micros();
 	tpsCounter.reset();
 }
 
 void loop() {
-	tpsCounter.update();
+	using SlimeVR::Debugging::ProfileScope;
+	using SlimeVR::Debugging::ProfileZone;
+
+	ProfileScope loopScope{ProfileZone::Loop};
+	const uint32_t loopPeriod = tpsCounter.update();
+	SlimeVR::Debugging::metrics.record(
+		SlimeVR::Debugging::Histogram::LoopPeriod,
+		loopPeriod
+	);
+	SlimeVR::Debugging::metrics.set(
+		SlimeVR::Debugging::Gauge::LoopRate,
+		tpsCounter.getAveragedTPS()
+	);
+	SlimeVR::Debugging::memoryMonitor.update();
 	globalTimer.tick();
 	SerialCommands::update();
 	OTA::otaUpdate();
-	networkManager.update();
-
-#if DEBUG_MEASURE_SENSOR_TIME_TAKEN
-	sensorMeasurer.before();
-#endif
-	sensorManager.update();
-#if DEBUG_MEASURE_SENSOR_TIME_TAKEN
-	sensorMeasurer.after();
-#endif
+	{
+		ProfileScope scope{ProfileZone::Network};
+		networkManager.update();
+	}
+	{
+		ProfileScope scope{ProfileZone::Sensors};
+		sensorManager.update();
+	}
 
 	battery.Loop();
 	ledManager.update();
@@ -0,0 +1,577 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "MockServer.h"
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "GlobalVars.h"
+#include "debugging/Metrics.h"
+#include "network/featureflags.h"
+#include "network/packets.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+// Packet type and packet number, present on every packet but the bundled ones
+constexpr size_t HeaderSize = 12;
+constexpr uint32_t HeartbeatIntervalMillis = 500;
+constexpr uint32_t PingIntervalMillis = 1000;
+
+template <typename T>
+T readBigEndian(const uint8_t* data) {
+	T value = 0;
+	for (size_t i = 0; i < sizeof(T); i++) {
+		value = (value << 8) | data[i];
+	}
+	return value;
+}
+
+template <typename T>
+void writeBigEndian(uint8_t* data, T value) {
+	for (size_t i = 0; i < sizeof(T); i++) {
+		data[i] = value >> ((sizeof(T) - 1 - i) * 8);
+	}
+}
+
+}  // namespace
+
+double MockServer::SensorStats::jitterMicros() const {
+	return intervals > 1 ? std::sqrt(intervalM2 / (intervals - 1)) : 0;
+}
+
+MockServer::MockServer(uint16_t port)
+	: m_Port(port) {
+	resetStats();
+}
+
+MockServer::~MockServer() {
+	if (m_Socket >= 0) {
+		close(m_Socket);
+	}
+}
+
+bool MockServer::begin() {
+	m_Socket = socket(AF_INET, SOCK_DGRAM, 0);
+	if (m_Socket < 0) {
+		return false;
+	}
+
+	sockaddr_in addr{};
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(m_Port);
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	if (bind(m_Socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+		close(m_Socket);
+		m_Socket = -1;
+		return false;
+	}
+	return true;
+}
+
+void MockServer::update(int waitMillis) {
+	if (waitMillis > 0) {
+		pollfd socket{m_Socket, POLLIN, 0};
+		poll(&socket, 1, waitMillis);
+	}
+
+	uint8_t buffer[1500];
+	while (true) {
+		sockaddr_in from{};
+		socklen_t fromLength = sizeof(from);
+		auto received = recvfrom(
+			m_Socket,
+			buffer,
+			sizeof(buffer),
+			MSG_DONTWAIT,
+			reinterpret_cast<sockaddr*>(&from),
+			&fromLength
+		);
+		if (received <= 0) {
+			break;
+		}
+		if (!m_Online) {
+			continue;
+		}
+
+		m_TrackerIP = from.sin_addr.s_addr;
+		m_TrackerPort = ntohs(from.sin_port);
+		m_Stats.datagrams++;
+		m_Stats.bytes += received;
+		handleDatagram(buffer, received, micros());
+	}
+
+	if (!m_Connected) {
+		return;
+	}
+
+	// The tracker drops the connection after 3s without hearing from us
+	if (millis() - m_LastHeartbeatMillis >= HeartbeatIntervalMillis) {
+		m_LastHeartbeatMillis = millis();
+		send(static_cast<uint8_t>(ReceivePacketType::HeartBeat), nullptr, 0);
+	}
+
+	// The tracker echoes pings back as they are
+	if (millis() - m_LastPingMillis >= PingIntervalMillis) {
+		m_LastPingMillis = millis();
+		uint8_t id[4];
+		writeBigEndian(id, ++m_PingId);
+		m_PingSentMicros = micros();
+		m_Stats.pings++;
+		send(static_cast<uint8_t>(ReceivePacketType::PingPong), id, sizeof(id));
+	}
+}
+
+void MockServer::setOnline(bool online) {
+	m_Online = online;
+	if (!online) {
+		m_Connected = false;
+		m_SentFeatureFlags = false;
+	}
+}
+
+void MockServer::resetStats() {
+	m_Stats = Stats{};
+	m_Stats.startMicros = micros();
+	m_SensorStats.clear();
+}
+
+void MockServer::printStats() const {
+	const auto seconds = (micros() - m_Stats.startMicros) / 1e6;
+	printf(
+		"%.0f datagrams/s, %.2f kB/s, %u bundles, %u lost, %u reordered, "
+		"%u malformed, rtt %.3f/%.3f ms (%u/%u pongs)\n",
+		m_Stats.datagrams / seconds,
+		m_Stats.bytes / seconds / 1e3,
+		m_Stats.bundles,
+		m_Stats.lost,
+		m_Stats.reordered,
+		m_Stats.malformed,
+		m_Stats.pongs != 0 ? m_Stats.roundTripMicros / 1e3 / m_Stats.pongs : 0,
+		m_Stats.maxRoundTripMicros / 1e3,
+		m_Stats.pongs,
+		m_Stats.pings
+	);
+
+	printf(
+		"  %6s %9s %8s %9s %9s %9s\n",
+		"sensor",
+		"packets/s",
+		"kB/s",
+		"rot/s",
+		"jitter ms",
+		"max ms"
+	);
+	for (size_t i = 0; i < m_SensorStats.size(); i++) {
+		const auto& sensor = m_SensorStats[i];
+		if (sensor.packets == 0) {
+			continue;
+		}
+		printf(
+			"  %6zu %9.1f %8.2f %9.1f %9.3f %9.3f\n",
+			i,
+			sensor.packets / seconds,
+			sensor.bytes / seconds / 1e3,
+			sensor.rotations / seconds,
+			sensor.jitterMicros() / 1e3,
+			sensor.maxIntervalMicros / 1e3
+		);
+	}
+
+	if (m_Telemetry.packets == 0) {
+		return;
+	}
+	using Debugging::Metrics;
+
+	// Names only match when the tracker runs the same build as the server
+	printf("  telemetry:");
+	for (size_t i = 0; i < m_Telemetry.counters.size(); i++) {
+		const auto counter = static_cast<Debugging::Counter>(i);
+		printf(
+			" %s=%u",
+			i < Metrics::CounterCount ? Metrics::name(counter) : "?",
+			m_Telemetry.counters[i]
+		);
+	}
+	for (size_t i = 0; i < m_Telemetry.gauges.size(); i++) {
+		const auto gauge = static_cast<Debugging::Gauge>(i);
+		printf(
+			" %s=%.1f",
+			i < Metrics::GaugeCount ? Metrics::name(gauge) : "?",
+			m_Telemetry.gauges[i]
+		);
+	}
+	printf("\n");
+
+	auto printHistogram = [](const char* name, const Telemetry::Histogram& histogram) {
+		printf(
+			"  %-18s %6u samples, p50 %6uus, p99 %6uus, max %6uus\n",
+			name,
+			histogram.count,
+			histogram.p50,
+			histogram.p99,
+			histogram.max
+		);
+	};
+	for (size_t i = 0; i < m_Telemetry.histograms.size(); i++) {
+		const auto histogram = static_cast<Debugging::Histogram>(i);
+		printHistogram(
+			i < Metrics::HistogramCount ? Metrics::name(histogram) : "?",
+			m_Telemetry.histograms[i]
+		);
+	}
+	for (const auto& sensor : m_Telemetry.sensors) {
+		char name[24];
+		snprintf(name, sizeof(name), "sensor %u (%.0f/s)", sensor.id, sensor.rate);
+		printHistogram(name, sensor.latency);
+	}
+}
+
+void MockServer::handleDatagram(
+	const uint8_t* data,
+	size_t size,
+	uint64_t receivedMicros
+) {
+	if (size < HeaderSize) {
+		m_Stats.malformed++;
+		return;
+	}
+
+	const auto type = data[3];
+	const auto packetNumber = readBigEndian<uint64_t>(data + 4);
+
+	// Pings come back with our own packet number
+	if (type == static_cast<uint8_t>(ReceivePacketType::PingPong)) {
+		if (size >= HeaderSize + 4
+			&& readBigEndian<uint32_t>(data + HeaderSize) == m_PingId) {
+			const auto roundTrip
+				= static_cast<uint32_t>(receivedMicros - m_PingSentMicros);
+			m_Stats.pongs++;
+			m_Stats.roundTripMicros += roundTrip;
+			m_Stats.maxRoundTripMicros
+				= std::max(m_Stats.maxRoundTripMicros, roundTrip);
+		}
+		return;
+	}
+
+	// The handshake is always sent as packet 0, and until there was one the
+	// tracker is unknown
+	if (type != static_cast<uint8_t>(SendPacketType::Handshake)) {
+		if (!m_Connected) {
+			return;
+		}
+		trackPacketNumber(packetNumber);
+	}
+
+	if (type != static_cast<uint8_t>(SendPacketType::Bundle)) {
+		handlePacket(
+			type,
+			packetNumber,
+			data + HeaderSize,
+			size - HeaderSize,
+			size,
+			receivedMicros
+		);
+		return;
+	}
+
+	// Bundled packets are prefixed by their size and have no packet number
+	m_Stats.bundles++;
+	for (size_t offset = HeaderSize; offset < size;) {
+		if (offset + 2 > size) {
+			m_Stats.malformed++;
+			return;
+		}
+		const auto length = readBigEndian<uint16_t>(data + offset);
+		offset += 2;
+		if (length < 4 || offset + length > size) {
+			m_Stats.malformed++;
+			return;
+		}
+		handlePacket(
+			data[offset + 3],
+			packetNumber,
+			data + offset + 4,
+			length - 4,
+			length + 2,
+			receivedMicros
+		);
+		offset += length;
+	}
+}
+
+void MockServer::handlePacket(
+	uint8_t type,
+	uint64_t packetNumber,
+	const uint8_t* payload,
+	size_t size,
+	size_t wireSize,
+	uint64_t receivedMicros
+) {
+	m_Stats.packets++;
+
+	auto* sensor = sensorStats(type, payload, size);
+	if (sensor != nullptr) {
+		sensor->packets++;
+		sensor->bytes += wireSize;
+	}
+
+	switch (static_cast<SendPacketType>(type)) {
+		case SendPacketType::Handshake: {
+			// The handshake reply has its type in the first byte
+			const char reply[] = "\x03Hey OVR =D 5";
+			m_Connected = true;
+			m_SentFeatureFlags = false;
+			m_NextTrackerPacketNumber = 0;
+			sendRaw(reinterpret_cast<const uint8_t*>(reply), sizeof(reply) - 1);
+			break;
+		}
+		case SendPacketType::FeatureFlags: {
+			uint8_t flags[ServerFeatures::BITS_TOTAL / 8 + 1]{};
+			flags[0] |= 1 << ServerFeatures::PROTOCOL_BUNDLE_SUPPORT;
+#if ENABLE_TELEMETRY
+			flags[0] |= 1 << ServerFeatures::PROTOCOL_TELEMETRY_SUPPORT;
+#endif
+			send(
+				static_cast<uint8_t>(ReceivePacketType::FeatureFlags),
+				flags,
+				sizeof(flags)
+			);
+			m_SentFeatureFlags = true;
+			break;
+		}
+		case SendPacketType::SensorInfo: {
+			if (size < 2) {
+				m_Stats.malformed++;
+				break;
+			}
+			// Acknowledges the sensor state, the tracker reads it right after the
+			// packet type
+			const uint8_t reply[]{
+				0,
+				0,
+				0,
+				static_cast<uint8_t>(ReceivePacketType::SensorInfo),
+				payload[0],
+				payload[1],
+			};
+			sendRaw(reply, sizeof(reply));
+			break;
+		}
+		case SendPacketType::RotationData: {
+			if (size < sizeof(RotationDataPacket)) {
+				m_Stats.malformed++;
+				break;
+			}
+			RotationDataPacket packet;
+			memcpy(&packet, payload, sizeof(packet));
+
+			m_Stats.rotations++;
+			sensor->rotations++;
+			if (sensor->lastRotationMicros != 0) {
+				const auto interval = receivedMicros - sensor->lastRotationMicros;
+				sensor->intervals++;
+				const auto delta = interval - sensor->intervalMean;
+				sensor->intervalMean += delta / sensor->intervals;
+				sensor->intervalM2 += delta * (interval - sensor->intervalMean);
+				sensor->maxIntervalMicros = std::max(
+					sensor->maxIntervalMicros,
+					static_cast<uint32_t>(interval)
+				);
+			}
+			sensor->lastRotationMicros = receivedMicros;
+
+			if (m_OnRotation) {
+				m_OnRotation({
+					.sensorId = packet.sensorId,
+					.rotation = Quat(packet.x, packet.y, packet.z, packet.w),
+					.packetNumber = packetNumber,
+					.receivedMicros = receivedMicros,
+				});
+			}
+			break;
+		}
+#if ENABLE_TELEMETRY
+		case SendPacketType::Telemetry:
+			handleTelemetry(payload, size);
+			break;
+#endif
+		default:
+			break;
+	}
+}
+
+void MockServer::handleTelemetry(const uint8_t* payload, size_t size) {
+	Telemetry telemetry{.packets = m_Telemetry.packets + 1};
+
+	size_t offset = 0;
+	auto read = [&](auto& value) {
+		using Value = std::remove_reference_t<decltype(value)>;
+		if (offset + sizeof(Value) > size) {
+			return false;
+		}
+		if constexpr (std::is_same_v<Value, float>) {
+			const auto bits = readBigEndian<uint32_t>(payload + offset);
+			memcpy(&value, &bits, sizeof(value));
+		} else if constexpr (sizeof(Value) == 1) {
+			value = payload[offset];
+		} else {
+			value = readBigEndian<Value>(payload + offset);
+		}
+		offset += sizeof(Value);
+		return true;
+	};
+	auto readHistogram = [&](Telemetry::Histogram& histogram) {
+		return read(histogram.count) && read(histogram.p50) && read(histogram.p99)
+			&& read(histogram.max);
+	};
+	auto readAll = [&](auto& values, auto readOne) {
+		uint8_t count = 0;
+		if (!read(count)) {
+			return false;
+		}
+		values.resize(count);
+		for (auto& value : values) {
+			if (!readOne(value)) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	if (!readAll(telemetry.counters, read) || !readAll(telemetry.gauges, read)) {
+		m_Stats.malformed++;
+		return;
+	}
+
+	// Trackers from before the histograms stop here
+	if (offset < size) {
+		auto readSensor = [&](Telemetry::Sensor& sensor) {
+			return read(sensor.id) && read(sensor.rate)
+				&& readHistogram(sensor.latency);
+		};
+		if (!readAll(telemetry.histograms, readHistogram)
+			|| !readAll(telemetry.sensors, readSensor)) {
+			m_Stats.malformed++;
+			return;
+		}
+	}
+
+	m_Telemetry = std::move(telemetry);
+}
+
+void MockServer::trackPacketNumber(uint64_t packetNumber) {
+	if (m_NextTrackerPacketNumber == 0) {
+		m_NextTrackerPacketNumber = packetNumber + 1;
+		return;
+	}
+
+	if (packetNumber >= m_NextTrackerPacketNumber) {
+		m_Stats.lost += packetNumber - m_NextTrackerPacketNumber;
+		m_NextTrackerPacketNumber = packetNumber + 1;
+		return;
+	}
+
+	// Arrived after a later one, so it was counted as lost
+	m_Stats.reordered++;
+	if (m_Stats.lost > 0) {
+		m_Stats.lost--;
+	}
+}
+
+MockServer::SensorStats*
+MockServer::sensorStats(uint8_t type, const uint8_t* payload, size_t size) {
+	size_t offset;
+	switch (static_cast<SendPacketType>(type)) {
+		case SendPacketType::Accel:
+			offset = offsetof(AccelPacket, sensorId);
+			break;
+		case SendPacketType::SensorInfo:
+		case SendPacketType::RotationData:
+		case SendPacketType::MagnetometerAccuracy:
+		case SendPacketType::Temperature:
+		case SendPacketType::FlexData:
+			offset = 0;
+			break;
+		default:
+			return nullptr;
+	}
+	if (offset >= size) {
+		return nullptr;
+	}
+
+	const auto id = payload[offset];
+	if (id >= m_SensorStats.size()) {
+		m_SensorStats.resize(id + 1);
+	}
+	return &m_SensorStats[id];
+}
+
+void MockServer::send(uint8_t type, const uint8_t* payload, size_t size) {
+	uint8_t buffer[HeaderSize + 64]{};
+	size = std::min(size, sizeof(buffer) - HeaderSize);
+	buffer[3] = type;
+	writeBigEndian(buffer + 4, m_PacketNumber++);
+	if (size != 0) {
+		memcpy(buffer + HeaderSize, payload, size);
+	}
+	sendRaw(buffer, HeaderSize + size);
+}
+
+void MockServer::sendRaw(const uint8_t* data, size_t size) {
+	if (m_Socket < 0 || !m_Connected) {
+		return;
+	}
+
+	sockaddr_in addr{};
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(m_TrackerPort);
+	addr.sin_addr.s_addr = m_TrackerIP;
+	sendto(m_Socket, data, size, 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+}
+
+bool connectTracker(MockServer& server, uint32_t timeoutMillis) {
+	const auto start = millis();
+	while (!server.isReady()) {
+		if (millis() - start > timeoutMillis) {
+			return false;
+		}
+		networkManager.update();
+		server.update();
+	}
+	return true;
+}
+
+}  // namespace SlimeVR::Native
@@ -0,0 +1,173 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <quat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace SlimeVR::Native {
+
+// Just enough of the SlimeVR server to keep a tracker streaming: answers the
+// discovery and feature flags requests (with bundle and telemetry support),
+// acknowledges sensor info, sends heartbeats and pings, and decodes the packets
+// the tracker sends back, bundled or not, keeping throughput statistics.
+class MockServer {
+public:
+	struct Rotation {
+		uint8_t sensorId;
+		Quat rotation;
+		// Number of the datagram carrying it, shared by a bundle
+		uint64_t packetNumber;
+		// micros() when the datagram was received
+		uint64_t receivedMicros;
+	};
+
+	struct SensorStats {
+		uint32_t packets = 0;
+		// Packet sizes including their header or bundle length prefix
+		uint64_t bytes = 0;
+		uint32_t rotations = 0;
+		uint64_t lastRotationMicros = 0;
+		// Running mean and variance of the time between rotations
+		uint32_t intervals = 0;
+		double intervalMean = 0;
+		double intervalM2 = 0;
+		uint32_t maxIntervalMicros = 0;
+
+		// Standard deviation of the time between rotations
+		[[nodiscard]] double jitterMicros() const;
+	};
+
+	struct Stats {
+		uint64_t startMicros = 0;
+		uint32_t datagrams = 0;
+		uint64_t bytes = 0;
+		uint32_t bundles = 0;
+		uint32_t packets = 0;
+		uint32_t rotations = 0;
+		uint32_t malformed = 0;
+		// Gaps in the packet numbers, bundles count once since they share one
+		uint32_t lost = 0;
+		uint32_t reordered = 0;
+		uint32_t pings = 0;
+		uint32_t pongs = 0;
+		uint64_t roundTripMicros = 0;
+		uint32_t maxRoundTripMicros = 0;
+	};
+
+	// Last telemetry packet, in the order of Debugging::Counter, Gauge and
+	// Histogram
+	struct Telemetry {
+		struct Histogram {
+			uint32_t count = 0;
+			uint32_t p50 = 0;
+			uint32_t p99 = 0;
+			uint32_t max = 0;
+		};
+		struct Sensor {
+			uint8_t id = 0;
+			float rate = 0;
+			Histogram latency;
+		};
+
+		uint32_t packets = 0;
+		std::vector<uint32_t> counters;
+		std::vector<float> gauges;
+		std::vector<Histogram> histograms;
+		std::vector<Sensor> sensors;
+	};
+
+	using RotationCallback = std::function<void(const Rotation&)>;
+
+	explicit MockServer(uint16_t port = 6969);
+	~MockServer();
+
+	// Has to be called before the tracker binds its own socket, which falls
+	// back to an ephemeral port when the server port is already taken
+	bool begin();
+	// Handles every datagram received since the last call, waiting up to
+	// `waitMillis` for one to arrive
+	void update(int waitMillis = 0);
+	// Offline, the server ignores everything as if it wasn't running. Coming
+	// back online it knows nothing of the tracker, like a restarted server.
+	void setOnline(bool online);
+	void resetStats();
+	// Prints the statistics gathered since the last reset
+	void printStats() const;
+
+	void onRotation(RotationCallback callback) { m_OnRotation = std::move(callback); }
+	// The tracker found the server and knows it can bundle packets
+	[[nodiscard]] bool isReady() const { return m_Connected && m_SentFeatureFlags; }
+	[[nodiscard]] const Stats& getStats() const { return m_Stats; }
+	[[nodiscard]] const Telemetry& getTelemetry() const { return m_Telemetry; }
+	// Indexed by sensor id
+	[[nodiscard]] const std::vector<SensorStats>& getSensorStats() const {
+		return m_SensorStats;
+	}
+
+private:
+	void handleDatagram(const uint8_t* data, size_t size, uint64_t receivedMicros);
+	void handlePacket(
+		uint8_t type,
+		uint64_t packetNumber,
+		const uint8_t* payload,
+		size_t size,
+		size_t wireSize,
+		uint64_t receivedMicros
+	);
+	void trackPacketNumber(uint64_t packetNumber);
+	void handleTelemetry(const uint8_t* payload, size_t size);
+	SensorStats* sensorStats(uint8_t type, const uint8_t* payload, size_t size);
+	// Sends a packet with the usual type and packet number header
+	void send(uint8_t type, const uint8_t* payload, size_t size);
+	void sendRaw(const uint8_t* data, size_t size);
+
+	uint16_t m_Port;
+	int m_Socket = -1;
+	// Tracker address in network byte order
+	uint32_t m_TrackerIP = 0;
+	uint16_t m_TrackerPort = 0;
+	bool m_Online = true;
+	bool m_Connected = false;
+	bool m_SentFeatureFlags = false;
+	uint64_t m_PacketNumber = 0;
+	uint64_t m_NextTrackerPacketNumber = 0;
+	uint32_t m_LastHeartbeatMillis = 0;
+	uint32_t m_LastPingMillis = 0;
+	uint32_t m_PingId = 0;
+	uint64_t m_PingSentMicros = 0;
+	RotationCallback m_OnRotation;
+	Stats m_Stats;
+	std::vector<SensorStats> m_SensorStats;
+	Telemetry m_Telemetry;
+};
+
+// Runs the firmware network code until the tracker streams to `server`
+bool connectTracker(MockServer& server, uint32_t timeoutMillis = 5000);
+
+}  // namespace SlimeVR::Native
@@ -0,0 +1,78 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "arguments.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace SlimeVR::Native {
+
+Arguments::Arguments(int argc, char** argv) {
+	for (int i = 0; i < argc; i++) {
+		const char* arg = argv[i];
+		if (strncmp(arg, "--", 2) != 0) {
+			m_Positional.push_back(arg);
+			continue;
+		}
+
+		const char* value = strchr(arg, '=');
+		if (value == nullptr) {
+			m_Flags.emplace_back(arg + 2, "");
+		} else {
+			m_Flags.emplace_back(std::string(arg + 2, value), value + 1);
+		}
+	}
+}
+
+const char* Arguments::positional(size_t index, const char* fallback) const {
+	return index < m_Positional.size() ? m_Positional[index] : fallback;
+}
+
+const char* Arguments::get(const char* key, const char* fallback) const {
+	const char* value = find(key);
+	return value != nullptr ? value : fallback;
+}
+
+long Arguments::get(const char* key, long fallback) const {
+	const char* value = find(key);
+	return value != nullptr ? strtol(value, nullptr, 10) : fallback;
+}
+
+float Arguments::get(const char* key, float fallback) const {
+	const char* value = find(key);
+	return value != nullptr ? strtof(value, nullptr) : fallback;
+}
+
+bool Arguments::has(const char* key) const { return find(key) != nullptr; }
+
+const char* Arguments::find(const char* key) const {
+	for (const auto& [name, value] : m_Flags) {
+		if (name == key) {
+			return value;
+		}
+	}
+	return nullptr;
+}
+
+}  // namespace SlimeVR::Native
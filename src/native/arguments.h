@@ -0,0 +1,51 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SlimeVR::Native {
+
+// Command line of a native tool: `--key=value` flags, anything else is a
+// positional argument
+class Arguments {
+public:
+	Arguments(int argc, char** argv);
+
+	[[nodiscard]] const char* positional(size_t index, const char* fallback) const;
+	[[nodiscard]] const char* get(const char* key, const char* fallback) const;
+	[[nodiscard]] long get(const char* key, long fallback) const;
+	[[nodiscard]] float get(const char* key, float fallback) const;
+	[[nodiscard]] bool has(const char* key) const;
+
+private:
+	[[nodiscard]] const char* find(const char* key) const;
+
+	std::vector<const char*> m_Positional;
+	std::vector<std::pair<std::string, const char*>> m_Flags;
+};
+
+}  // namespace SlimeVR::Native
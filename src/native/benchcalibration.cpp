@@ -0,0 +1,214 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `bench-calibration` tool: powers up a simulated sensor with no stored
+// calibration many times over and reports how long the runtime calibration
+// steps and the rest calibration take to complete. The clock is frozen and
+// advanced by a fixed step per loop, so sessions run as fast as the host can
+// process them instead of in real time.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "arguments.h"
+#include "clock.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+struct CalibrationBenchmark {
+	Sim::SimulationConfig config;
+	uint32_t sessions;
+	uint32_t timeoutSeconds;
+	// Simulated time per firmware loop
+	uint32_t stepMicros;
+};
+
+enum Milestone {
+	Timesteps,
+	Motionless,
+	GyroBias,
+	RestCalibration,
+	// All of the above that apply to the IMU
+	Calibrated,
+	MilestoneCount,
+};
+
+constexpr const char* MilestoneNames[MilestoneCount]
+	= {"timesteps", "motionless", "gyro bias", "rest", "calibrated"};
+
+// Without USE_RUNTIME_CALIBRATION only the rest calibration is timed
+template <typename Device>
+constexpr bool HasRuntimeCalibration
+	= requires(typename Device::Sensor& sensor) { sensor.calibrator.getCalibration(); };
+
+float percentile(const std::vector<float>& sorted, float fraction) {
+	return sorted[static_cast<size_t>(fraction * (sorted.size() - 1))];
+}
+
+template <typename Device>
+void measure(const CalibrationBenchmark& run) {
+	constexpr bool hasMotionless
+		= requires { typename Device::Driver::MotionlessCalibrationData; };
+
+	std::vector<float> seconds[MilestoneCount];
+	uint32_t timedOut = 0;
+	uint64_t simulatedMicros = 0;
+	const auto wallStart = std::chrono::steady_clock::now();
+
+	for (uint32_t session = 0; session < run.sessions; session++) {
+		configuration.eraseSensors();
+
+		auto config = run.config;
+		config.seed += session;
+		auto imu = std::make_unique<typename Device::Simulator>(config);
+		auto sensor = std::make_unique<typename Device::Sensor>(0, *imu, 0.0f);
+
+		const auto start = micros();
+		sensor->motionSetup();
+		if (!sensor->isWorking()) {
+			printf("%-12s failed to initialize\n", Device::Name);
+			return;
+		}
+
+		// Milestones that don't apply count as reached from the start
+		bool reached[MilestoneCount]{};
+		if constexpr (!HasRuntimeCalibration<Device>) {
+			reached[Timesteps] = reached[Motionless] = reached[GyroBias] = true;
+		}
+		reached[Motionless] |= !hasMotionless;
+		while (!reached[Calibrated]) {
+			const auto elapsed = micros() - start;
+			if (elapsed >= run.timeoutSeconds * 1000000ull) {
+				timedOut++;
+				break;
+			}
+
+			sensor->motionLoop();
+			advanceTime(run.stepMicros);
+
+			bool done[MilestoneCount]{};
+			if constexpr (HasRuntimeCalibration<Device>) {
+				const auto& active = sensor->calibrator.getActiveCalibration();
+				const auto& saved = sensor->calibrator.getCalibration();
+				done[Timesteps] = active.sensorTimestepsCalibrated;
+				done[Motionless] = saved.motionlessCalibrated;
+				done[GyroBias] = saved.gyroPointsCalibrated != 0;
+			}
+			done[RestCalibration] = sensor->hasCompletedRestCalibration();
+			bool all = true;
+			for (int milestone = 0; milestone < Calibrated; milestone++) {
+				if (!reached[milestone] && done[milestone]) {
+					reached[milestone] = true;
+					seconds[milestone].push_back(elapsed / 1e6f);
+				}
+				all &= reached[milestone];
+			}
+			if (all) {
+				reached[Calibrated] = true;
+				seconds[Calibrated].push_back(elapsed / 1e6f);
+			}
+		}
+
+		simulatedMicros += micros() - start;
+	}
+
+	const auto wallSeconds
+		= std::chrono::duration<float>(std::chrono::steady_clock::now() - wallStart)
+			  .count();
+	printf(
+		"%s: %u sessions, %u timed out, %.0fx real time\n",
+		Device::Name,
+		run.sessions,
+		timedOut,
+		simulatedMicros / 1e6f / wallSeconds
+	);
+	printf(
+		"  %-10s %6s %8s %8s %8s %8s\n",
+		"seconds",
+		"n",
+		"mean",
+		"p50",
+		"p90",
+		"max"
+	);
+	for (int milestone = 0; milestone < MilestoneCount; milestone++) {
+		auto& values = seconds[milestone];
+		if (values.empty()) {
+			printf("  %-10s %6u\n", MilestoneNames[milestone], 0);
+			continue;
+		}
+		std::sort(values.begin(), values.end());
+		float sum = 0;
+		for (auto value : values) {
+			sum += value;
+		}
+		printf(
+			"  %-10s %6zu %8.2f %8.2f %8.2f %8.2f\n",
+			MilestoneNames[milestone],
+			values.size(),
+			sum / values.size(),
+			percentile(values, 0.5f),
+			percentile(values, 0.9f),
+			values.back()
+		);
+	}
+}
+
+}  // namespace
+
+int runCalibrationBenchmark(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	CalibrationBenchmark run{
+		.config = Sim::simulationConfig(args),
+		.sessions
+		= static_cast<uint32_t>(strtoul(args.positional(1, "100"), nullptr, 10)),
+		.timeoutSeconds = static_cast<uint32_t>(args.get("timeout", 120L)),
+		.stepMicros = static_cast<uint32_t>(args.get("step", 1000L)),
+	};
+	// Calibration needs the sensor to rest
+	if (!args.has("motion")) {
+		run.config.motion.type = Sim::Motion::Type::Still;
+	}
+
+	configuration.setup();
+
+	freezeTime(micros());
+	Sim::forEachSimulatedDevice(args.positional(0, "all"), [&](auto device) {
+		measure<decltype(device)>(run);
+	});
+	resumeTime();
+
+	// Leaves no calibration from the last session behind
+	configuration.eraseSensors();
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
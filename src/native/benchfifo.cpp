@@ -0,0 +1,202 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `bench-fifo` tool: measures how fast each SoftFusion driver parses its FIFO.
+// The reads of every driver are recorded once from the simulated chip and then
+// replayed from memory, so only the driver's own work is timed. The drivers call
+// the tape directly, like the firmware's bound sensors, or through the virtual
+// RegisterInterface with --virtual.
+
+#include <chrono>
+#include <type_traits>
+#include <vector>
+
+#include "arguments.h"
+#include "logging/Logger.h"
+#include "sim/Simulators.h"
+#include "sim/TapeRegisterInterface.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+struct FifoBenchmark {
+	Sim::SimulationConfig config;
+	uint32_t intervalMicros;
+	uint32_t reads;
+	uint32_t iterations;
+};
+
+// Keeps the compiler from dropping the parsed samples
+volatile int64_t sampleChecksum;
+
+struct SampleSink {
+	int64_t sum = 0;
+	uint64_t samples = 0;
+};
+
+// The ICM-42688 FIFO layout depends on DEBUG_ICM42688_HIRES, so tell the two
+// builds apart in the output
+template <typename Device>
+const char* benchmarkName() {
+	using ICM42688
+		= Sensors::SoftFusion::Drivers::ICM42688<Sensors::RegisterInterface>;
+	if constexpr (std::is_same_v<typename Device::Driver, ICM42688>) {
+		return DEBUG_ICM42688_HIRES ? "ICM-42688-hr" : "ICM-42688";
+	}
+	return Device::Name;
+}
+
+template <typename Driver>
+bool initialize(Driver& driver) {
+	if constexpr (requires { typename Driver::MotionlessCalibrationData; }) {
+		typename Driver::MotionlessCalibrationData calibData{};
+		return driver.initialize(calibData);
+	} else {
+		return driver.initialize();
+	}
+}
+
+template <typename Driver>
+void bulkRead(Driver& driver, SampleSink& sink) {
+	driver.bulkRead(DriverCallbacks{
+		[&](const auto sample[3], float AccTs) {
+			sink.sum += sample[0] + sample[1] + sample[2];
+			sink.samples++;
+		},
+		[&](const auto sample[3], float GyrTs) {
+			sink.sum += sample[0] + sample[1] + sample[2];
+			sink.samples++;
+		},
+		[&](int16_t sample, float TempTs) { sink.sum += sample; },
+	});
+}
+
+// The driver is bound to the tape's type unless RegInterface is the virtual base
+template <typename Device, typename RegInterface>
+void benchmark(const FifoBenchmark& bench) {
+	using Driver = typename Device::template DriverFor<RegInterface>;
+	using Clock = std::chrono::steady_clock;
+	const auto name = benchmarkName<Device>();
+
+	Logging::Logger logger(name);
+	typename Device::Simulator imu(bench.config);
+	Sim::TapeRegisterInterface tape(imu);
+	Driver driver(tape, logger);
+
+	if (!initialize(driver)) {
+		printf("%-12s failed to initialize\n", name);
+		return;
+	}
+
+	// Drivers can adapt their reads to what they saw, so every replay starts
+	// from the state the recording did
+	const Driver initialDriver = driver;
+	SampleSink recorded;
+	tape.setMode(Sim::TapeRegisterInterface::Mode::Record);
+	for (uint32_t i = 0; i < bench.reads; i++) {
+		imu.advance(bench.intervalMicros);
+		bulkRead(driver, recorded);
+	}
+
+	tape.setMode(Sim::TapeRegisterInterface::Mode::Replay);
+	SampleSink sink;
+	const auto parseStart = Clock::now();
+	for (uint32_t n = 0; n < bench.iterations; n++) {
+		tape.rewind();
+		auto replayDriver = initialDriver;
+		for (uint32_t i = 0; i < bench.reads; i++) {
+			bulkRead(replayDriver, sink);
+		}
+	}
+	const auto parseEnd = Clock::now();
+
+	std::vector<uint8_t> scratch;
+	for (uint32_t n = 0; n < bench.iterations; n++) {
+		tape.replayReads(scratch);
+	}
+	const auto ioEnd = Clock::now();
+
+	if (sink.samples != recorded.samples * bench.iterations) {
+		printf("%-12s replay diverged from the recording\n", name);
+		return;
+	}
+
+	const auto parseNanos = std::chrono::duration<double, std::nano>(
+		parseEnd - parseStart
+	).count();
+	const auto ioNanos
+		= std::chrono::duration<double, std::nano>(ioEnd - parseEnd).count();
+	const double samples = sink.samples;
+	const double bytes = tape.getRecordedFifoBytes() * double(bench.iterations);
+
+	printf(
+		"%-12s %9.1f %10.2f %9.1f %9.1f %9.1f\n",
+		name,
+		recorded.samples / static_cast<double>(bench.reads),
+		parseNanos / samples,
+		bytes / parseNanos * 1e3,
+		ioNanos / (bench.reads * double(bench.iterations)),
+		(parseNanos - ioNanos) / (bench.reads * double(bench.iterations))
+	);
+	sampleChecksum = sink.sum;
+}
+
+}  // namespace
+
+int runFifoBenchmark(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	auto config = Sim::simulationConfig(args);
+	// The bus is not part of what is measured here
+	config.bus = {};
+
+	FifoBenchmark bench{
+		.config = config,
+		.intervalMicros = static_cast<uint32_t>(args.get("interval", 10L) * 1000),
+		.reads = static_cast<uint32_t>(args.get("reads", 500L)),
+		.iterations = static_cast<uint32_t>(args.get("iterations", 200L)),
+	};
+
+	printf(
+		"%-12s %9s %10s %9s %9s %9s\n",
+		"imu",
+		"smp/read",
+		"ns/sample",
+		"MB/s",
+		"io ns",
+		"parse ns"
+	);
+	const bool virtualCalls = args.has("virtual");
+	Sim::forEachSimulatedDevice(args.positional(0, "all"), [&](auto device) {
+		if (virtualCalls) {
+			benchmark<decltype(device), Sensors::RegisterInterface>(bench);
+		} else {
+			benchmark<decltype(device), Sim::TapeRegisterInterface>(bench);
+		}
+	});
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
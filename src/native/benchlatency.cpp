@@ -0,0 +1,285 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `bench-latency` tool: measures how long a motion takes to reach the server.
+// Simulated IMUs turn in sudden steps while the regular SensorManager::update()
+// and Connection code stream to a MockServer over loopback, and every step is
+// timed through the stages between the IMU and the received datagram.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "GlobalVars.h"
+#include "MockServer.h"
+#include "arguments.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+struct LatencyBenchmark {
+	Sim::SimulationConfig config;
+	uint32_t seconds;
+	uint32_t count;
+	// Time spent in the rest of the firmware loop per iteration
+	uint32_t workMicros;
+};
+
+enum Stage {
+	// Until the IMU takes its next sample
+	Sampling,
+	// The sample waits in the FIFO for the 100Hz send interval of the sensor
+	Polling,
+	// FIFO read, fusion and packet building in SensorManager::update()
+	Processing,
+	// PACKET_BUNDLING_BUFFERED waiting for the other sensors
+	Bundling,
+	// From the end of the update that sent it until the server has it
+	Transport,
+	Total,
+	StageCount,
+};
+
+constexpr const char* StageNames[StageCount]
+	= {"imu odr", "fifo wait", "process", "bundling", "udp", "total"};
+
+// Progress of one sensor through its current step
+struct StepTracker {
+	Sim::SimulatedImu* imu;
+	::Sensor* sensor;
+	uint32_t step;
+	uint64_t startMicros = 0;
+	Quat fusedBase;
+	Quat receivedBase;
+	bool hasReceivedBase = false;
+	// Bounds of the update that published the step
+	uint64_t fusedMicros = 0;
+	uint64_t processedMicros = 0;
+};
+
+float angleBetween(const Quat& a, const Quat& b) {
+	const auto delta = a.inverse() * b;
+	const Vector3 axis(delta.x, delta.y, delta.z);
+	return 2 * std::atan2(axis.length(), std::abs(delta.w));
+}
+
+float percentile(const std::vector<float>& sorted, float fraction) {
+	return sorted[static_cast<size_t>(fraction * (sorted.size() - 1))];
+}
+
+template <typename Device>
+void measure(const LatencyBenchmark& run, MockServer& server) {
+	const auto& motion = run.config.motion;
+	// Steps are timed when they are halfway done, well clear of the noise
+	const float threshold = motion.amplitude / 2;
+
+	std::vector<std::unique_ptr<typename Device::Simulator>> imus;
+	std::vector<StepTracker> trackers;
+	auto& sensors = sensorManager.getSensors();
+	for (uint32_t i = 0; i < run.count; i++) {
+		auto config = run.config;
+		config.seed += i;
+		imus.push_back(std::make_unique<typename Device::Simulator>(config));
+
+		auto sensor = std::make_unique<typename Device::Sensor>(i, *imus.back(), 0.0f);
+		sensor->motionSetup();
+		if (!sensor->isWorking()) {
+			printf("%-12s failed to initialize\n", Device::Name);
+			sensors.clear();
+			return;
+		}
+		trackers.push_back({imus.back().get(), sensor.get(), 0});
+		sensors.push_back(std::move(sensor));
+	}
+
+	// Leaves the fusion some time to settle before the first measured step
+	const auto start = micros();
+	for (auto& tracker : trackers) {
+		while (tracker.imu->toMicros(motion.stepTime(tracker.step)) < start + 300000) {
+			tracker.step++;
+		}
+		tracker.startMicros = tracker.imu->toMicros(motion.stepTime(tracker.step));
+	}
+
+	std::vector<float> stages[StageCount];
+	uint32_t missed = 0;
+	uint64_t updateEnd = 0;
+
+	auto nextStep = [&](StepTracker& tracker) {
+		tracker.step++;
+		tracker.startMicros = tracker.imu->toMicros(motion.stepTime(tracker.step));
+		tracker.fusedMicros = 0;
+	};
+
+	server.onRotation([&](const MockServer::Rotation& rotation) {
+		if (rotation.sensorId >= trackers.size()) {
+			return;
+		}
+		auto& tracker = trackers[rotation.sensorId];
+		if (rotation.receivedMicros < tracker.startMicros) {
+			tracker.receivedBase = rotation.rotation;
+			tracker.hasReceivedBase = true;
+			return;
+		}
+		if (!tracker.hasReceivedBase || tracker.fusedMicros == 0
+			|| angleBetween(tracker.receivedBase, rotation.rotation) < threshold) {
+			return;
+		}
+
+		const auto eventTime = motion.stepTime(tracker.step, threshold);
+		const int64_t timestamps[StageCount]{
+			static_cast<int64_t>(tracker.imu->toMicros(eventTime)),
+			static_cast<int64_t>(tracker.imu->nextSampleMicros(eventTime)),
+			static_cast<int64_t>(tracker.fusedMicros),
+			static_cast<int64_t>(tracker.processedMicros),
+			static_cast<int64_t>(updateEnd),
+			static_cast<int64_t>(rotation.receivedMicros),
+		};
+		for (int stage = 0; stage < Total; stage++) {
+			stages[stage].push_back((timestamps[stage + 1] - timestamps[stage]) / 1e3f);
+		}
+		stages[Total].push_back((timestamps[Total] - timestamps[0]) / 1e3f);
+
+		nextStep(tracker);
+	});
+
+	while (micros() - start < run.seconds * 1000000ull) {
+		networkManager.update();
+
+		const auto before = micros();
+		sensorManager.update();
+		updateEnd = micros();
+
+		for (auto& tracker : trackers) {
+			if (before >= tracker.imu->toMicros(motion.stepTime(tracker.step + 1))) {
+				missed++;
+				nextStep(tracker);
+			}
+
+			const auto& fused = tracker.sensor->getFusedRotation();
+			if (updateEnd < tracker.startMicros) {
+				tracker.fusedBase = fused;
+			} else if (tracker.fusedMicros == 0
+					   && angleBetween(tracker.fusedBase, fused) >= threshold) {
+				tracker.fusedMicros = before;
+				tracker.processedMicros = updateEnd;
+			}
+		}
+
+		server.update();
+		delayMicroseconds(run.workMicros);
+	}
+
+	server.onRotation(nullptr);
+	sensors.clear();
+
+	printf(
+		"%s x%u: %zu steps, %u missed\n",
+		Device::Name,
+		run.count,
+		stages[Total].size(),
+		missed
+	);
+	if (stages[Total].empty()) {
+		return;
+	}
+	printf("  %-10s %8s %8s %8s %8s %8s\n", "ms", "mean", "p50", "p90", "p99", "max");
+	for (int stage = 0; stage < StageCount; stage++) {
+		auto& values = stages[stage];
+		std::sort(values.begin(), values.end());
+		float sum = 0;
+		for (auto value : values) {
+			sum += value;
+		}
+		printf(
+			"  %-10s %8.3f %8.3f %8.3f %8.3f %8.3f\n",
+			StageNames[stage],
+			sum / values.size(),
+			percentile(values, 0.5f),
+			percentile(values, 0.9f),
+			percentile(values, 0.99f),
+			values.back()
+		);
+	}
+}
+
+}  // namespace
+
+int runLatencyBenchmark(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	LatencyBenchmark run{
+		.config = Sim::simulationConfig(args),
+		.seconds
+		= static_cast<uint32_t>(strtoul(args.positional(1, "10"), nullptr, 10)),
+		.count = static_cast<uint32_t>(args.get("count", 1L)),
+		.workMicros = static_cast<uint32_t>(args.get("work", 0L)),
+	};
+	// Connection keeps per sensor state for this many sensors only
+	if (run.count > MAX_SENSORS_COUNT) {
+		fprintf(stderr, "This build supports up to %d sensors\n", MAX_SENSORS_COUNT);
+		return 1;
+	}
+
+	// The step interval isn't a multiple of the 10ms send interval, so the
+	// steps land at every phase of it
+	auto& motion = run.config.motion;
+	motion.type = Sim::Motion::Type::Steps;
+	motion.amplitude = args.get("step", 10.0f) * DEG_TO_RAD;
+	motion.rate = args.get("rate", 500.0f) * DEG_TO_RAD;
+	motion.frequency = 1000 / args.get("interval", 103.7f);
+
+	configuration.setup();
+
+	MockServer server;
+	if (!server.begin()) {
+		fprintf(stderr, "Can't listen on UDP port 6969, is a server running?\n");
+		return 1;
+	}
+
+	if (!connectTracker(server)) {
+		fprintf(stderr, "The tracker didn't connect to the mock server\n");
+		return 1;
+	}
+
+	Sim::forEachSimulatedDevice(args.positional(0, "all"), [&](auto device) {
+		measure<decltype(device)>(run, server);
+	});
+
+	const auto& stats = server.getStats();
+	printf(
+		"Server received %u datagrams, %u bundles, %u rotations, %u malformed\n",
+		stats.datagrams,
+		stats.bundles,
+		stats.rotations,
+		stats.malformed
+	);
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
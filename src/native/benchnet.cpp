@@ -0,0 +1,157 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `bench-net` tool: streams simulated sensors through SensorManager and
+// Connection to a MockServer over loopback and reports what the server sees,
+// for one or more sensor counts.
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "GlobalVars.h"
+#include "MockServer.h"
+#include "arguments.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+struct NetworkBenchmark {
+	Sim::SimulationConfig config;
+	uint32_t seconds;
+	std::vector<uint32_t> counts;
+	// Time spent in the rest of the firmware loop per iteration
+	uint32_t workMicros;
+};
+
+// Keeps the first rotations and sensor info exchange out of the statistics
+constexpr uint32_t WarmupMicros = 500000;
+
+template <typename Device>
+void measure(const NetworkBenchmark& run, uint32_t count, MockServer& server) {
+	std::vector<std::unique_ptr<typename Device::Simulator>> imus;
+	auto& sensors = sensorManager.getSensors();
+	uint64_t firstSetupMicros = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		auto config = run.config;
+		config.seed += i;
+		imus.push_back(std::make_unique<typename Device::Simulator>(config));
+
+		auto sensor = std::make_unique<typename Device::Sensor>(i, *imus.back(), 0.0f);
+		sensor->motionSetup();
+		if (!sensor->isWorking()) {
+			printf("%-12s failed to initialize\n", Device::Name);
+			sensors.clear();
+			return;
+		}
+		sensors.push_back(std::move(sensor));
+		if (i == 0) {
+			firstSetupMicros = micros();
+		}
+	}
+
+	// Sensors that waited for the others to set up catch up on the 100Hz send
+	// intervals they missed, so that is left out too
+	auto start = micros();
+	const auto warmupMicros = WarmupMicros + 2 * (start - firstSetupMicros);
+	bool warm = false;
+	uint32_t loops = 0;
+	uint64_t updateMicros = 0;
+	while (!warm || micros() - start < run.seconds * 1000000ull) {
+		if (!warm && micros() - start >= warmupMicros) {
+			warm = true;
+			start = micros();
+			loops = 0;
+			updateMicros = 0;
+			server.resetStats();
+		}
+
+		networkManager.update();
+
+		const auto before = micros();
+		sensorManager.update();
+		updateMicros += micros() - before;
+		loops++;
+
+		server.update();
+		delayMicroseconds(run.workMicros);
+	}
+
+	printf(
+		"%s x%u: %.0f loops/s, %.1f us/update, ",
+		Device::Name,
+		count,
+		loops / static_cast<float>(run.seconds),
+		updateMicros / static_cast<float>(loops)
+	);
+	server.printStats();
+	sensors.clear();
+}
+
+}  // namespace
+
+int runNetworkBenchmark(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	NetworkBenchmark run{
+		.config = Sim::simulationConfig(args),
+		.seconds = static_cast<uint32_t>(strtoul(args.positional(1, "5"), nullptr, 10)),
+		.counts = {},
+		.workMicros = static_cast<uint32_t>(args.get("work", 0L)),
+	};
+
+	for (const char* count = args.get("count", "1"); *count != '\0';) {
+		char* end;
+		run.counts.push_back(strtoul(count, &end, 10));
+		if (run.counts.back() == 0 || run.counts.back() > MAX_SENSORS_COUNT) {
+			fprintf(stderr, "Sensor counts go from 1 to %d\n", MAX_SENSORS_COUNT);
+			return 1;
+		}
+		count = *end == ',' ? end + 1 : end;
+	}
+
+	configuration.setup();
+
+	MockServer server;
+	if (!server.begin()) {
+		fprintf(stderr, "Can't listen on UDP port 6969, is a server running?\n");
+		return 1;
+	}
+	if (!connectTracker(server)) {
+		fprintf(stderr, "The tracker didn't connect to the mock server\n");
+		return 1;
+	}
+
+	Sim::forEachSimulatedDevice(args.positional(0, "all"), [&](auto device) {
+		for (auto count : run.counts) {
+			measure<decltype(device)>(run, count, server);
+		}
+	});
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
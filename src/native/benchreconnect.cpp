@@ -0,0 +1,232 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `bench-reconnect` tool: takes a MockServer offline and back again many times
+// over and reports how long a streaming tracker takes to notice and to stream
+// again. Like `bench-calibration`, it runs on a frozen clock that is advanced
+// by a fixed step per loop instead of waiting in real time.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "GlobalVars.h"
+#include "MockServer.h"
+#include "arguments.h"
+#include "clock.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+struct ReconnectBenchmark {
+	Sim::SimulationConfig config;
+	uint32_t sessions;
+	// Each outage lasts between half and one and a half of this
+	float offlineSeconds;
+	float uptimeSeconds;
+	uint32_t timeoutSeconds;
+	// Simulated time per firmware loop
+	uint32_t stepMicros;
+};
+
+enum Stage {
+	// From the server going offline until the tracker gives up on it
+	Timeout,
+	// From the server coming back until the tracker has the feature flags
+	Handshake,
+	// From the server coming back until it receives a rotation
+	Streaming,
+	StageCount,
+};
+
+constexpr const char* StageNames[StageCount] = {"timeout", "handshake", "streaming"};
+
+float percentile(const std::vector<float>& sorted, float fraction) {
+	return sorted[static_cast<size_t>(fraction * (sorted.size() - 1))];
+}
+
+template <typename Device>
+void measure(const ReconnectBenchmark& run, MockServer& server) {
+	auto imu = std::make_unique<typename Device::Simulator>(run.config);
+	auto& sensors = sensorManager.getSensors();
+	sensors.push_back(std::make_unique<typename Device::Sensor>(0, *imu, 0.0f));
+	sensors.back()->motionSetup();
+	if (!sensors.back()->isWorking()) {
+		printf("%-12s failed to initialize\n", Device::Name);
+		sensors.clear();
+		return;
+	}
+
+	uint64_t lastRotationMicros = 0;
+	server.onRotation([&](const MockServer::Rotation& rotation) {
+		lastRotationMicros = rotation.receivedMicros;
+	});
+
+	auto loopFor = [&](uint64_t durationMicros, auto&& done) {
+		const auto start = micros();
+		while (micros() - start < durationMicros) {
+			if (done()) {
+				return true;
+			}
+			networkManager.update();
+			sensorManager.update();
+			server.update();
+			advanceTime(run.stepMicros);
+		}
+		return false;
+	};
+
+	std::mt19937 random(run.config.seed);
+	std::uniform_real_distribution<float> outage(
+		run.offlineSeconds * 0.5f,
+		run.offlineSeconds * 1.5f
+	);
+	std::vector<float> seconds[StageCount];
+	uint32_t failed = 0;
+	uint64_t simulatedMicros = 0;
+	const auto wallStart = std::chrono::steady_clock::now();
+
+	for (uint32_t session = 0; session < run.sessions; session++) {
+		const auto sessionStart = micros();
+		loopFor(run.uptimeSeconds * 1e6f, [] { return false; });
+
+		server.setOnline(false);
+		const auto offlineStart = micros();
+		const auto offlineMicros = static_cast<uint64_t>(outage(random) * 1e6f);
+		bool timedOut = loopFor(offlineMicros, [] {
+			return !networkConnection.isConnected();
+		});
+		if (timedOut) {
+			seconds[Timeout].push_back((micros() - offlineStart) / 1e6f);
+			loopFor(offlineMicros - (micros() - offlineStart), [] { return false; });
+		}
+
+		server.setOnline(true);
+		const auto onlineStart = micros();
+		const auto timeoutMicros = run.timeoutSeconds * 1000000ull;
+		bool ready = loopFor(timeoutMicros, [&] {
+			return server.isReady() && networkConnection.isConnected();
+		});
+		if (ready) {
+			seconds[Handshake].push_back((micros() - onlineStart) / 1e6f);
+		}
+		bool streaming = ready && loopFor(timeoutMicros, [&] {
+			return lastRotationMicros >= onlineStart && server.isReady();
+		});
+		if (streaming) {
+			seconds[Streaming].push_back((micros() - onlineStart) / 1e6f);
+		} else {
+			failed++;
+		}
+
+		simulatedMicros += micros() - sessionStart;
+	}
+
+	server.onRotation(nullptr);
+	sensors.clear();
+
+	const auto wallSeconds
+		= std::chrono::duration<float>(std::chrono::steady_clock::now() - wallStart)
+			  .count();
+	printf(
+		"%s: %u sessions, %u failed, %.0fx real time\n",
+		Device::Name,
+		run.sessions,
+		failed,
+		simulatedMicros / 1e6f / wallSeconds
+	);
+	printf(
+		"  %-10s %6s %8s %8s %8s %8s\n",
+		"seconds",
+		"n",
+		"mean",
+		"p50",
+		"p90",
+		"max"
+	);
+	for (int stage = 0; stage < StageCount; stage++) {
+		auto& values = seconds[stage];
+		if (values.empty()) {
+			printf("  %-10s %6u\n", StageNames[stage], 0);
+			continue;
+		}
+		std::sort(values.begin(), values.end());
+		float sum = 0;
+		for (auto value : values) {
+			sum += value;
+		}
+		printf(
+			"  %-10s %6zu %8.2f %8.2f %8.2f %8.2f\n",
+			StageNames[stage],
+			values.size(),
+			sum / values.size(),
+			percentile(values, 0.5f),
+			percentile(values, 0.9f),
+			values.back()
+		);
+	}
+}
+
+}  // namespace
+
+int runReconnectBenchmark(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	ReconnectBenchmark run{
+		.config = Sim::simulationConfig(args),
+		.sessions
+		= static_cast<uint32_t>(strtoul(args.positional(1, "100"), nullptr, 10)),
+		.offlineSeconds = args.get("offline", 5.0f),
+		.uptimeSeconds = args.get("uptime", 2.0f),
+		.timeoutSeconds = static_cast<uint32_t>(args.get("timeout", 30L)),
+		.stepMicros = static_cast<uint32_t>(args.get("step", 1000L)),
+	};
+
+	configuration.setup();
+
+	MockServer server;
+	if (!server.begin()) {
+		fprintf(stderr, "Can't listen on UDP port 6969, is a server running?\n");
+		return 1;
+	}
+
+	if (!connectTracker(server)) {
+		fprintf(stderr, "The tracker didn't connect to the mock server\n");
+		return 1;
+	}
+
+	freezeTime(micros());
+	Sim::forEachSimulatedDevice(args.positional(0, "lsm6dsv"), [&](auto device) {
+		measure<decltype(device)>(run, server);
+	});
+	resumeTime();
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
@@ -0,0 +1,318 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `bench-sensors` tool: runs a growing number of simulated sensors through
+// SensorManager and Connection, directly on the bus, behind a simulated I2C
+// mux like on the glove boards or split over both I2C controllers, to find the
+// count where the loop falls below the IMU data rate and the FIFOs start
+// dropping samples.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "GlobalVars.h"
+#include "MockServer.h"
+#include "arguments.h"
+#include "debugging/BusMonitor.h"
+#include "debugging/Profiler.h"
+#include "sensorinterface/I2CPCAInterface.h"
+#include "sim/SimulatedMux.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+enum class Layout {
+	Direct,
+	// Two sensors per mux channel, like BOARD_GLOVE_IMU_SLIMEVR_DEV
+	Mux,
+	// Every other sensor on the second I2C controller
+	Dual,
+};
+
+const char* layoutName(Layout layout) {
+	switch (layout) {
+		case Layout::Direct:
+			return "direct";
+		case Layout::Mux:
+			return "mux";
+		case Layout::Dual:
+			return "dual";
+	}
+	return "";
+}
+
+struct ScalingBenchmark {
+	Sim::SimulationConfig config;
+	uint32_t seconds;
+	std::vector<uint32_t> counts;
+	std::vector<Layout> layouts;
+	// Time spent in the rest of the firmware loop per iteration
+	uint32_t workMicros;
+};
+
+constexpr uint8_t MuxAddress = 0x70;
+// Pins of the second controller in the dual layout
+constexpr uint8_t SecondSclPin = 25;
+constexpr uint8_t SecondSdaPin = 26;
+constexpr uint32_t WarmupMicros = 500000;
+// Fusion rate under which a sensor counts as not keeping up with its IMU
+constexpr float KeepUpRatio = 0.98f;
+
+template <typename Device>
+void measure(
+	const ScalingBenchmark& run,
+	Layout layout,
+	uint32_t count,
+	MockServer& server
+) {
+	Sim::SimulatedMux mux(MuxAddress, run.config.bus);
+	std::vector<std::unique_ptr<typename Device::Simulator>> imus;
+	std::vector<std::unique_ptr<SensorInterface>> interfaces;
+	auto& sensors = sensorManager.getSensors();
+	uint64_t firstSetupMicros = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		auto config = run.config;
+		config.seed += i;
+		imus.push_back(std::make_unique<typename Device::Simulator>(config));
+
+		SensorInterface* sensorInterface = nullptr;
+		if (layout == Layout::Dual) {
+			const uint8_t bus = i % 2;
+			interfaces.push_back(std::make_unique<I2CWireSensorInterface>(
+				bus == 0 ? PIN_IMU_SCL : SecondSclPin,
+				bus == 0 ? PIN_IMU_SDA : SecondSdaPin,
+				bus
+			));
+			sensorInterface = interfaces.back().get();
+			imus.back()->attachTo(bus);
+		} else if (layout == Layout::Mux) {
+			const uint8_t channel = i / 2;
+			interfaces.push_back(std::make_unique<I2CPCASensorInterface>(
+				PIN_IMU_SCL,
+				PIN_IMU_SDA,
+				MuxAddress,
+				channel
+			));
+			sensorInterface = interfaces.back().get();
+			sensorInterface->init();
+			sensorInterface->swapIn();
+			imus.back()->connectThrough(mux, channel);
+		}
+
+		auto sensor = std::make_unique<typename Device::Sensor>(
+			i,
+			*imus.back(),
+			0.0f,
+			sensorInterface
+		);
+		sensor->motionSetup();
+		if (!sensor->isWorking()) {
+			printf("%-12s failed to initialize\n", Device::Name);
+			sensors.clear();
+			return;
+		}
+		sensors.push_back(std::move(sensor));
+		if (i == 0) {
+			firstSetupMicros = micros();
+		}
+	}
+
+	auto start = micros();
+	const auto warmupMicros = WarmupMicros + 2 * (start - firstSetupMicros);
+	bool warm = false;
+	uint32_t loops = 0;
+	uint64_t updateMicros = 0;
+	uint32_t maxUpdateMicros = 0;
+	std::vector<Sim::SimulationStats> warmStats(count);
+	uint64_t warmMuxMicros = 0;
+	while (!warm || micros() - start < run.seconds * 1000000ull) {
+		if (!warm && micros() - start >= warmupMicros) {
+			warm = true;
+			start = micros();
+			loops = 0;
+			updateMicros = 0;
+			maxUpdateMicros = 0;
+			for (uint32_t i = 0; i < count; i++) {
+				warmStats[i] = imus[i]->getStats();
+			}
+			warmMuxMicros = mux.getBusMicros();
+			server.resetStats();
+			Debugging::profiler.reset();
+		}
+
+		{
+			Debugging::ProfileScope scope{Debugging::ProfileZone::Network};
+			networkManager.update();
+		}
+
+		const auto before = micros();
+		{
+			Debugging::ProfileScope scope{Debugging::ProfileZone::Sensors};
+			sensorManager.update();
+		}
+		const uint32_t elapsed = micros() - before;
+		updateMicros += elapsed;
+		maxUpdateMicros = std::max(maxUpdateMicros, elapsed);
+		loops++;
+
+		server.update();
+		delayMicroseconds(run.workMicros);
+	}
+
+	uint32_t dropped = 0;
+	uint32_t misrouted = 0;
+	uint64_t busMicros = mux.getBusMicros() - warmMuxMicros;
+	for (uint32_t i = 0; i < count; i++) {
+		const auto& stats = imus[i]->getStats();
+		dropped += stats.framesDropped - warmStats[i].framesDropped;
+		misrouted += stats.misrouted - warmStats[i].misrouted;
+		busMicros += stats.busMicros - warmStats[i].busMicros;
+	}
+
+	float minFusionRate = 0;
+	float fusionRate = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		const auto rate = sensors[i]->m_tpsCounter.getAveragedTPS();
+		minFusionRate = i == 0 ? rate : std::min(minFusionRate, rate);
+		fusionRate += rate / count;
+	}
+
+	const float odr = 1.0f / Device::Driver::GyrTs;
+	const bool keepsUp = minFusionRate >= odr * KeepUpRatio && dropped == 0;
+	printf(
+		"%-12s %-6s %3u %8.0f %8.1f %7u %6.1f%% %7.0f %7.0f %7.0f %8u %9.1f %6u  %s\n",
+		Device::Name,
+		layoutName(layout),
+		count,
+		loops / static_cast<float>(run.seconds),
+		updateMicros / static_cast<float>(loops),
+		maxUpdateMicros,
+		busMicros / (run.seconds * 1e6f) * 100,
+		odr,
+		fusionRate,
+		minFusionRate,
+		dropped,
+		server.getStats().bundles / static_cast<float>(run.seconds),
+		misrouted,
+		keepsUp ? "yes" : "NO"
+	);
+	if (Debugging::profiler.isEnabled()) {
+		Debugging::profiler.print();
+		Debugging::busMonitor.print();
+	}
+	sensors.clear();
+}
+
+}  // namespace
+
+int runScalingBenchmark(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	ScalingBenchmark run{
+		.config = Sim::simulationConfig(args),
+		.seconds = static_cast<uint32_t>(strtoul(args.positional(1, "3"), nullptr, 10)),
+		.counts = {},
+		.layouts = {},
+		.workMicros = static_cast<uint32_t>(args.get("work", 0L)),
+	};
+
+	// Bus time is most of what a sensor costs, so this one assumes a real bus
+	if (!args.has("i2c")) {
+		run.config.bus.clockHz = I2C_SPEED;
+	}
+	// The fusion rate is averaged over whole seconds
+	run.seconds = std::max(run.seconds, 2u);
+
+	for (const char* count = args.get("count", "1,2,4,8,12,16"); *count != '\0';) {
+		char* end;
+		run.counts.push_back(strtoul(count, &end, 10));
+		if (run.counts.back() == 0 || run.counts.back() > MAX_SENSORS_COUNT) {
+			fprintf(stderr, "Sensor counts go from 1 to %d\n", MAX_SENSORS_COUNT);
+			return 1;
+		}
+		count = *end == ',' ? end + 1 : end;
+	}
+
+	const char* layout = args.get("layout", "both");
+	if (strcmp(layout, "direct") == 0 || strcmp(layout, "both") == 0) {
+		run.layouts.push_back(Layout::Direct);
+	}
+	if (strcmp(layout, "mux") == 0 || strcmp(layout, "both") == 0) {
+		run.layouts.push_back(Layout::Mux);
+	}
+	if (strcmp(layout, "dual") == 0) {
+		run.layouts.push_back(Layout::Dual);
+	}
+	if (run.layouts.empty()) {
+		fprintf(stderr, "Layouts are direct, mux, both or dual\n");
+		return 1;
+	}
+
+	configuration.setup();
+	Debugging::profiler.setEnabled(args.has("profile"));
+	Debugging::busMonitor.setEnabled(args.has("profile"));
+
+	MockServer server;
+	if (!server.begin()) {
+		fprintf(stderr, "Can't listen on UDP port 6969, is a server running?\n");
+		return 1;
+	}
+	if (!connectTracker(server)) {
+		fprintf(stderr, "The tracker didn't connect to the mock server\n");
+		return 1;
+	}
+
+	printf(
+		"%-12s %-6s %3s %8s %8s %7s %7s %7s %7s %7s %8s %9s %6s  %s\n",
+		"imu",
+		"layout",
+		"n",
+		"loops/s",
+		"us/upd",
+		"max us",
+		"bus",
+		"odr",
+		"fused",
+		"min",
+		"dropped",
+		"bundles/s",
+		"misrt",
+		"keeps up"
+	);
+	Sim::forEachSimulatedDevice(args.positional(0, "lsm6dsv"), [&](auto device) {
+		for (auto layout : run.layouts) {
+			for (auto count : run.counts) {
+				measure<decltype(device)>(run, layout, count, server);
+			}
+		}
+	});
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
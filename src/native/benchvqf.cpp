@@ -0,0 +1,400 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `bench-vqf` tool: measures the cost of VQF and BasicVQF updates at the
+// sample rates the trackers run at, and how far the resulting orientation is
+// from the truth and from a reference run. Build variants are selected with
+// SENSORS_DOUBLE_PRECISION and VQF_NO_MOTION_BIAS_ESTIMATION, see the
+// native-vqf-* environments; compare them against a reference saved by the
+// default build.
+
+#include <algorithm>
+#include <array>
+#include <basicvqf.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <vqf.h>
+
+#include "arguments.h"
+#include "consts.h"
+#include "sensors/SensorFusion.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+using Orientation = std::array<vqf_real_t, 4>;
+
+struct ImuSample {
+	// rad/s, m/s² and arbitrary units
+	vqf_real_t gyr[3];
+	vqf_real_t acc[3];
+	vqf_real_t mag[3];
+};
+
+struct Dataset {
+	float rate;
+	std::vector<ImuSample> samples;
+	// Ground truth orientation per sample, empty for recorded data
+	std::vector<Quat> truth;
+	bool hasMag;
+};
+
+enum Update : uint8_t {
+	Gyr = 1 << 0,
+	Acc = 1 << 1,
+	Mag = 1 << 2,
+};
+
+struct FilterResult {
+	double gyrNanos;
+	double accNanos;
+	double magNanos;
+	std::vector<Orientation> orientations;
+};
+
+// Synthesizes a dataset from the same motion and noise model as `sim`
+Dataset
+generateDataset(const Sim::SimulationConfig& config, float rate, float seconds) {
+	const auto& motion = config.motion;
+	const Vector3 north(1, 0, -1);
+
+	std::mt19937 random(config.seed);
+	std::normal_distribution<float> normal;
+	const auto gyroNoise = config.gyroNoiseDps * DEG_TO_RAD;
+	const auto accelNoise = config.accelNoiseG * CONST_EARTH_GRAVITY;
+
+	Dataset dataset{.rate = rate, .hasMag = true};
+	const auto count = static_cast<size_t>(rate * seconds);
+	for (size_t i = 0; i < count; i++) {
+		const double t = i / rate;
+		const Quat orientation(motion.axis, motion.angle(t));
+		// Mean rate over the sample interval, so integrating it is exact and any
+		// error left is the filter's
+		const auto delta = motion.angle(t + 1 / rate) - motion.angle(t);
+		const auto gyro
+			= motion.axis * (delta * rate) + config.gyroBiasDps * DEG_TO_RAD;
+		const auto accel = orientation.xform_inv(Vector3(0, 0, CONST_EARTH_GRAVITY));
+		const auto mag = orientation.xform_inv(north);
+
+		ImuSample sample;
+		for (int axis = 0; axis < 3; axis++) {
+			sample.gyr[axis] = gyro[axis] + normal(random) * gyroNoise;
+			sample.acc[axis] = accel[axis] + normal(random) * accelNoise;
+			sample.mag[axis] = mag[axis] + normal(random) * 0.01f;
+		}
+		dataset.samples.push_back(sample);
+		dataset.truth.push_back(Quat(motion.axis, motion.angle(t + 1 / rate)));
+	}
+	return dataset;
+}
+
+// Reads a recording with one sample per line: gx gy gz ax ay az [mx my mz],
+// separated by spaces or commas
+bool loadDataset(const char* path, float rate, Dataset& dataset) {
+	FILE* file = fopen(path, "r");
+	if (file == nullptr) {
+		return false;
+	}
+
+	dataset = Dataset{.rate = rate, .hasMag = true};
+	char line[256];
+	while (fgets(line, sizeof(line), file) != nullptr) {
+		std::replace(line, line + strlen(line), ',', ' ');
+		double v[9];
+		const auto fields = sscanf(
+			line,
+			"%lf %lf %lf %lf %lf %lf %lf %lf %lf",
+			&v[0],
+			&v[1],
+			&v[2],
+			&v[3],
+			&v[4],
+			&v[5],
+			&v[6],
+			&v[7],
+			&v[8]
+		);
+		if (fields < 6) {
+			continue;
+		}
+		dataset.hasMag &= fields == 9;
+
+		ImuSample sample{};
+		for (int axis = 0; axis < 3; axis++) {
+			sample.gyr[axis] = v[axis];
+			sample.acc[axis] = v[3 + axis];
+			sample.mag[axis] = fields == 9 ? v[6 + axis] : 0;
+		}
+		dataset.samples.push_back(sample);
+	}
+	fclose(file);
+	return !dataset.samples.empty();
+}
+
+VQF makeFilter(VQF*, vqf_real_t ts) { return VQF(Sensors::DefaultVQFParams, ts); }
+BasicVQF makeFilter(BasicVQF*, vqf_real_t ts) { return BasicVQF(ts); }
+
+// Runs the dataset through a fresh filter with the given updates enabled and
+// returns the time spent in nanoseconds
+template <typename Filter>
+double runFilter(
+	const Dataset& dataset,
+	uint8_t updates,
+	std::vector<Orientation>* orientations
+) {
+	using Clock = std::chrono::steady_clock;
+	const vqf_real_t ts = 1 / dataset.rate;
+	auto filter = makeFilter(static_cast<Filter*>(nullptr), ts);
+	if (orientations != nullptr) {
+		orientations->resize(dataset.samples.size());
+	}
+
+	const auto start = Clock::now();
+	for (size_t i = 0; i < dataset.samples.size(); i++) {
+		const auto& sample = dataset.samples[i];
+		filter.updateGyr(sample.gyr, ts);
+		if (updates & Acc) {
+			filter.updateAcc(sample.acc);
+		}
+		if (updates & Mag) {
+			filter.updateMag(sample.mag);
+		}
+		if (orientations != nullptr) {
+			filter.getQuat6D((*orientations)[i].data());
+		}
+	}
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Each update is timed as the difference between runs with and without it,
+// taking the fastest of several runs to filter out scheduling noise
+template <typename Filter>
+FilterResult benchmarkFilter(const Dataset& dataset, uint32_t iterations) {
+	double gyr = INFINITY;
+	double gyrAcc = INFINITY;
+	double gyrAccMag = INFINITY;
+	for (uint32_t i = 0; i < iterations; i++) {
+		gyr = std::min(gyr, runFilter<Filter>(dataset, Gyr, nullptr));
+		gyrAcc = std::min(gyrAcc, runFilter<Filter>(dataset, Gyr | Acc, nullptr));
+		if (dataset.hasMag) {
+			gyrAccMag = std::min(
+				gyrAccMag,
+				runFilter<Filter>(dataset, Gyr | Acc | Mag, nullptr)
+			);
+		}
+	}
+
+	FilterResult result;
+	const double count = dataset.samples.size();
+	result.gyrNanos = gyr / count;
+	result.accNanos = (gyrAcc - gyr) / count;
+	result.magNanos = dataset.hasMag ? (gyrAccMag - gyrAcc) / count : NAN;
+	runFilter<Filter>(dataset, Gyr | Acc, &result.orientations);
+	return result;
+}
+
+Quat toQuat(const Orientation& wxyz) {
+	return Quat(wxyz[1], wxyz[2], wxyz[3], wxyz[0]);
+}
+
+// Angle between where the filter and the truth think down is. 6D orientation
+// has no heading reference, so only inclination can be compared.
+float tiltError(const Quat& estimate, const Quat& truth) {
+	const Vector3 up(0, 0, 1);
+	const auto dot = estimate.xform_inv(up).dot(truth.xform_inv(up));
+	return std::acos(std::clamp(dot, -1.0f, 1.0f)) * RAD_TO_DEG;
+}
+
+// Uses the vector part of a⁻¹b rather than acos of the dot product, which
+// can't resolve the small differences between build variants
+float angleBetween(const Orientation& a, const Orientation& b) {
+	const double w = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+	const double x = a[0] * b[1] - b[0] * a[1] - (a[2] * b[3] - a[3] * b[2]);
+	const double y = a[0] * b[2] - b[0] * a[2] - (a[3] * b[1] - a[1] * b[3]);
+	const double z = a[0] * b[3] - b[0] * a[3] - (a[1] * b[2] - a[2] * b[1]);
+	return 2 * std::atan2(std::sqrt(x * x + y * y + z * z), std::abs(w)) * RAD_TO_DEG;
+}
+
+using Reference = std::map<std::string, std::vector<Orientation>>;
+
+// Reference files hold one `<filter>@<rate> w x y z` line per sample
+bool loadReference(const char* path, Reference& reference) {
+	FILE* file = fopen(path, "r");
+	if (file == nullptr) {
+		return false;
+	}
+	char key[32];
+	double q[4];
+	while (fscanf(file, "%31s %lf %lf %lf %lf", key, &q[0], &q[1], &q[2], &q[3]) == 5) {
+		reference[key].push_back({static_cast<vqf_real_t>(q[0]),
+								  static_cast<vqf_real_t>(q[1]),
+								  static_cast<vqf_real_t>(q[2]),
+								  static_cast<vqf_real_t>(q[3])});
+	}
+	fclose(file);
+	return true;
+}
+
+void saveReference(FILE* file, const std::string& key, const FilterResult& result) {
+	for (const auto& q : result.orientations) {
+		fprintf(file, "%s %.9g %.9g %.9g %.9g\n", key.c_str(), q[0], q[1], q[2], q[3]);
+	}
+}
+
+template <typename Filter>
+void report(
+	const char* name,
+	const Dataset& dataset,
+	uint32_t iterations,
+	const Reference& reference,
+	FILE* referenceOut
+) {
+	const auto result = benchmarkFilter<Filter>(dataset, iterations);
+	const auto key = std::string(name) + "@" + std::to_string(int(dataset.rate));
+
+	// Skip the first second while the filter converges
+	const auto settled = static_cast<size_t>(dataset.rate);
+	float tiltSum = 0;
+	float tiltMax = 0;
+	size_t tiltCount = 0;
+	for (size_t i = settled; i < dataset.truth.size(); i++) {
+		const auto error = tiltError(toQuat(result.orientations[i]), dataset.truth[i]);
+		tiltSum += error * error;
+		tiltMax = std::max(tiltMax, error);
+		tiltCount++;
+	}
+
+	float referenceMax = NAN;
+	const auto found = reference.find(key);
+	if (found != reference.end()
+		&& found->second.size() == result.orientations.size()) {
+		referenceMax = 0;
+		for (size_t i = 0; i < result.orientations.size(); i++) {
+			referenceMax = std::max(
+				referenceMax,
+				angleBetween(result.orientations[i], found->second[i])
+			);
+		}
+	}
+
+	printf(
+		"%-9s %5.0f %8.1f %8.1f %8.1f %9.3f %9.3f %9.4f\n",
+		name,
+		dataset.rate,
+		result.gyrNanos,
+		result.accNanos,
+		result.magNanos,
+		tiltCount != 0 ? std::sqrt(tiltSum / tiltCount) : NAN,
+		tiltCount != 0 ? tiltMax : NAN,
+		referenceMax
+	);
+
+	if (referenceOut != nullptr) {
+		saveReference(referenceOut, key, result);
+	}
+}
+
+}  // namespace
+
+int runVqfBenchmark(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	const auto seconds = strtof(args.positional(0, "60"), nullptr);
+	const auto iterations = static_cast<uint32_t>(args.get("iterations", 5L));
+	const auto config = Sim::simulationConfig(args);
+
+	std::vector<Dataset> datasets;
+	if (args.has("data")) {
+		Dataset dataset;
+		const auto rate = args.get("data-rate", 200.0f);
+		if (!loadDataset(args.get("data", ""), rate, dataset)) {
+			fprintf(stderr, "Can't read dataset %s\n", args.get("data", ""));
+			return 1;
+		}
+		datasets.push_back(std::move(dataset));
+	} else {
+		for (float rate : {200.0f, 400.0f, 800.0f}) {
+			datasets.push_back(generateDataset(config, rate, seconds));
+		}
+	}
+
+	Reference reference;
+	if (args.has("reference") && !loadReference(args.get("reference", ""), reference)) {
+		fprintf(stderr, "Can't read reference %s\n", args.get("reference", ""));
+		return 1;
+	}
+
+	FILE* referenceOut = nullptr;
+	if (args.has("save-reference")) {
+		referenceOut = fopen(args.get("save-reference", ""), "w");
+		if (referenceOut == nullptr) {
+			fprintf(
+				stderr,
+				"Can't write reference %s\n",
+				args.get("save-reference", "")
+			);
+			return 1;
+		}
+	}
+
+	printf(
+		"vqf_real_t: %s, motion bias estimation: %s\n",
+		sizeof(vqf_real_t) == sizeof(float) ? "float" : "double",
+#ifdef VQF_NO_MOTION_BIAS_ESTIMATION
+		"off"
+#else
+		"on"
+#endif
+	);
+	printf(
+		"%-9s %5s %8s %8s %8s %9s %9s %9s\n",
+		"filter",
+		"Hz",
+		"gyr ns",
+		"acc ns",
+		"mag ns",
+		"tilt rms°",
+		"tilt max°",
+		"ref max°"
+	);
+	for (const auto& dataset : datasets) {
+		report<VQF>("VQF", dataset, iterations, reference, referenceOut);
+		report<BasicVQF>("BasicVQF", dataset, iterations, reference, referenceOut);
+	}
+
+	if (referenceOut != nullptr) {
+		fclose(referenceOut);
+	}
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
@@ -0,0 +1,236 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// Entry point of the native (host) build. The globals are the same as in
+// src/main.cpp so the tracker code links unchanged; WiFi, OTA and serial
+// commands are left out.
+
+#include <i2cscan.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "GlobalVars.h"
+#include "arguments.h"
+#include "batterymonitor.h"
+#include "debugging/Memory.h"
+#include "debugging/Metrics.h"
+#include "debugging/Profiler.h"
+#include "debugging/Tracer.h"
+#include "globals.h"
+#include "logging/Logger.h"
+#include "status/TPSCounter.h"
+#include "tools.h"
+
+Timer<> globalTimer;
+SlimeVR::Logging::Logger logger("SlimeVR");
+SlimeVR::Sensors::SensorManager sensorManager;
+SlimeVR::LEDManager ledManager;
+SlimeVR::Status::StatusManager statusManager;
+SlimeVR::Configuration::Configuration configuration;
+SlimeVR::Network::Manager networkManager;
+SlimeVR::Network::Connection networkConnection;
+SlimeVR::WiFiNetwork wifiNetwork;
+SlimeVR::WifiProvisioning wifiProvisioning;
+
+BatteryMonitor battery;
+TPSCounter tpsCounter;
+
+namespace SlimeVR::Native {
+
+namespace {
+
+class FilePrint : public Print {
+public:
+	explicit FilePrint(const char* path)
+		: m_File(fopen(path, "wb")) {}
+	~FilePrint() {
+		if (m_File != nullptr) {
+			fclose(m_File);
+		}
+	}
+
+	[[nodiscard]] bool isOpen() const { return m_File != nullptr; }
+
+	size_t write(uint8_t c) override { return write(&c, 1); }
+	size_t write(const uint8_t* buffer, size_t size) override {
+		return fwrite(buffer, 1, size, m_File);
+	}
+	using Print::write;
+
+private:
+	FILE* m_File;
+};
+
+void setup() {
+	globalTimer = timer_create_default();
+
+	logger.info("SlimeVR v" FIRMWARE_VERSION " starting up (native)...");
+	Debugging::memoryMonitor.markStage("boot");
+
+	statusManager.setStatus(SlimeVR::Status::LOADING, true);
+
+	ledManager.setup();
+	configuration.setup();
+	Debugging::memoryMonitor.markStage("configuration");
+
+	Wire.begin(static_cast<int>(PIN_IMU_SDA), static_cast<int>(PIN_IMU_SCL));
+	Wire.setClock(I2C_SPEED);
+
+	sensorManager.setup();
+	Debugging::memoryMonitor.markStage("sensors");
+
+	networkManager.setup();
+	battery.Setup();
+	Debugging::memoryMonitor.markStage("network");
+
+	statusManager.setStatus(SlimeVR::Status::LOADING, false);
+
+	sensorManager.postSetup();
+	Debugging::memoryMonitor.markStage("post setup");
+
+	tpsCounter.reset();
+}
+
+void loop() {
+	using Debugging::ProfileScope;
+	using Debugging::ProfileZone;
+
+	ProfileScope loopScope{ProfileZone::Loop};
+	const uint32_t loopPeriod = tpsCounter.update();
+	Debugging::metrics.record(Debugging::Histogram::LoopPeriod, loopPeriod);
+	Debugging::metrics.set(Debugging::Gauge::LoopRate, tpsCounter.getAveragedTPS());
+	Debugging::memoryMonitor.update();
+	globalTimer.tick();
+	{
+		ProfileScope scope{ProfileZone::Network};
+		networkManager.update();
+	}
+	{
+		ProfileScope scope{ProfileZone::Sensors};
+		sensorManager.update();
+	}
+
+	battery.Loop();
+	ledManager.update();
+}
+
+}  // namespace
+
+int runFirmware(int argc, char** argv) {
+	Arguments args(argc, argv);
+	unsigned long seconds = strtoul(args.positional(0, "0"), nullptr, 10);
+
+	setup();
+	Debugging::profiler.setEnabled(args.has("profile"));
+	if (args.has("trace")) {
+		Debugging::tracer.start();
+	}
+
+	auto start = millis();
+	while (seconds == 0 || millis() - start < seconds * 1000) {
+		loop();
+	}
+
+	logger.info("Ran for %lus at %.1f loops/s", seconds, tpsCounter.getAveragedTPS());
+	if (Debugging::profiler.isEnabled()) {
+		Debugging::profiler.print();
+	}
+	if (Debugging::tracer.isEnabled()) {
+		FilePrint trace(args.get("trace", ""));
+		if (!trace.isOpen()) {
+			logger.error("Couldn't write the trace to %s", args.get("trace", ""));
+			return 1;
+		}
+		Debugging::tracer.dump(trace);
+	}
+	return 0;
+}
+
+namespace {
+
+const Tool tools[] = {
+	{"run", "[seconds] [--profile] [--trace=<file>]", runFirmware},
+	{"sim",
+	 "[imu|all] [seconds] [--count=<n>] [--work=<us>] [--overrun=<ms>] "
+	 "[--record=<kB>] "
+	 "[simulation flags, see sim/Simulators.h]",
+	 runSimulation},
+	{"bench-fifo",
+	 "[imu|all] [--interval=<ms>] [--reads=<n>] [--iterations=<n>] [--virtual] "
+	 "[simulation flags]",
+	 runFifoBenchmark},
+	{"bench-vqf",
+	 "[seconds] [--data=<file> [--data-rate=<hz>]] [--iterations=<n>] "
+	 "[--reference=<file>] [--save-reference=<file>] [simulation flags]",
+	 runVqfBenchmark},
+	{"replay", "[--out=<csv>]", runReplay},
+	{"bench-latency",
+	 "[imu|all] [seconds] [--count=<n>] [--work=<us>] [--step=<deg>] "
+	 "[--rate=<dps>] [--interval=<ms>] [simulation flags]",
+	 runLatencyBenchmark},
+	{"server", "[seconds] [--port=<n>] [--report=<s>]", runMockServer},
+	{"bench-net",
+	 "[imu|all] [seconds] [--count=<n>[,<n>...]] [--work=<us>] [simulation flags]",
+	 runNetworkBenchmark},
+	{"bench-calibration",
+	 "[imu|all] [sessions] [--timeout=<s>] [--step=<us>] [simulation flags]",
+	 runCalibrationBenchmark},
+	{"bench-reconnect",
+	 "[imu] [sessions] [--offline=<s>] [--uptime=<s>] [--timeout=<s>] "
+	 "[--step=<us>] [simulation flags]",
+	 runReconnectBenchmark},
+	{"bench-sensors",
+	 "[imu|all] [seconds] [--count=<n>[,<n>...]] [--layout=direct|mux|both|dual] "
+	 "[--work=<us>] [--profile] [simulation flags]",
+	 runScalingBenchmark},
+};
+
+void printUsage(const char* program) {
+	fprintf(stderr, "Usage: %s <tool> [args...]\n\nTools:\n", program);
+	for (const auto& tool : tools) {
+		fprintf(stderr, "  %s %s\n", tool.name, tool.usage);
+	}
+}
+
+}  // namespace
+
+}  // namespace SlimeVR::Native
+
+int main(int argc, char** argv) {
+	using namespace SlimeVR::Native;
+
+	if (argc < 2) {
+		return runFirmware(0, nullptr);
+	}
+
+	for (const auto& tool : tools) {
+		if (strcmp(argv[1], tool.name) == 0) {
+			return tool.run(argc - 2, argv + 2);
+		}
+	}
+
+	printUsage(argv[0]);
+	return 1;
+}
@@ -0,0 +1,350 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `replay` tool: feeds an IMU recording made with DEBUG_RECORD_IMU through the
+// same SoftFusion sensor, calibrator and fusion as on the tracker. The
+// recording is read from /imurec of the native LittleFS root, so unpacking the
+// tracker's filesystem image there also brings along its calibration.
+//
+// The sensor is initialized against a simulated chip, then every read in
+// motionLoop() is answered from the recording with the clock frozen at the
+// time the tracker made it.
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "FSHelper.h"
+#include "arguments.h"
+#include "clock.h"
+#include "sensorinterface/RecordingRegisterInterface.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+namespace ImuRecording = Sensors::ImuRecording;
+
+struct Record {
+	uint64_t micros;
+	uint8_t regAddr;
+	uint8_t size;
+	size_t offset;
+};
+
+struct Recording {
+	ImuRecording::SegmentHeader header;
+	// Whether the recording goes back to sensor setup or the ring wrapped
+	bool complete;
+	std::vector<uint8_t> data;
+	std::vector<Record> records;
+};
+
+bool loadRecording(Recording& recording) {
+	std::vector<std::pair<ImuRecording::SegmentHeader, std::vector<uint8_t>>> segments;
+	for (size_t i = 0; i < ImuRecording::SegmentCount; i++) {
+		auto file = Utils::openFile(ImuRecording::segmentPath(i).c_str(), "r");
+		ImuRecording::SegmentHeader header;
+		if (file.size() < sizeof(header)
+			|| !file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header))
+			|| header.magic != ImuRecording::Magic
+			|| header.version != ImuRecording::Version) {
+			continue;
+		}
+
+		std::vector<uint8_t> data(file.size() - sizeof(header));
+		file.read(data.data(), data.size());
+		segments.emplace_back(header, std::move(data));
+	}
+	if (segments.empty()) {
+		return false;
+	}
+
+	std::sort(segments.begin(), segments.end(), [](const auto& a, const auto& b) {
+		return a.first.sequence < b.first.sequence;
+	});
+	recording.header = segments.front().first;
+	recording.complete = recording.header.sequence == 0;
+
+	// Timestamps are 32 bit on the tracker, unwrap them relative to setup
+	uint64_t time = recording.header.setupMicros;
+	uint32_t lastTimestamp = recording.header.setupMicros;
+	for (const auto& [header, data] : segments) {
+		size_t offset = 0;
+		while (offset + ImuRecording::RecordHeaderSize <= data.size()) {
+			uint32_t timestamp;
+			memcpy(&timestamp, &data[offset], sizeof(timestamp));
+			const uint8_t regAddr = data[offset + 4];
+			const uint8_t size = data[offset + 5];
+			offset += ImuRecording::RecordHeaderSize;
+			// Cut short by a reset while writing
+			if (offset + size > data.size()) {
+				break;
+			}
+
+			time += static_cast<uint32_t>(timestamp - lastTimestamp);
+			lastTimestamp = timestamp;
+			recording.records.push_back(
+				{time, regAddr, size, recording.data.size()}
+			);
+			recording.data.insert(
+				recording.data.end(),
+				data.begin() + offset,
+				data.begin() + offset + size
+			);
+			offset += size;
+		}
+	}
+	return !recording.records.empty();
+}
+
+// Answers reads from the recording once replay starts, and from the chip
+// model before that
+class ReplayRegisterInterface : public Sensors::RegisterInterface {
+public:
+	ReplayRegisterInterface(Sim::SimulatedImu& imu, const Recording& recording)
+		: m_Imu(imu)
+		, m_Recording(recording) {}
+
+	void startReplay() { m_Replaying = true; }
+	[[nodiscard]] bool finished() const {
+		return m_Next == m_Recording.records.size();
+	}
+	[[nodiscard]] uint64_t nextMicros() const {
+		return m_Recording.records[m_Next].micros;
+	}
+	[[nodiscard]] size_t position() const { return m_Next; }
+	void skip() {
+		m_Next++;
+		m_Resyncs++;
+	}
+	[[nodiscard]] size_t getResyncs() const { return m_Resyncs; }
+
+	[[nodiscard]] uint8_t readReg(uint8_t regAddr) const final {
+		uint8_t value;
+		readBytes(regAddr, sizeof(value), &value);
+		return value;
+	}
+
+	[[nodiscard]] uint16_t readReg16(uint8_t regAddr) const final {
+		uint8_t buffer[2];
+		readBytes(regAddr, sizeof(buffer), buffer);
+		return buffer[0] | (buffer[1] << 8);
+	}
+
+	void writeReg(uint8_t regAddr, uint8_t value) const final {
+		writeBytes(regAddr, sizeof(value), &value);
+	}
+
+	void writeReg16(uint8_t regAddr, uint16_t value) const final {
+		uint8_t buffer[2]
+			= {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8)};
+		writeBytes(regAddr, sizeof(buffer), buffer);
+	}
+
+	void readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final {
+		if (!m_Replaying) {
+			m_Imu.readBytes(regAddr, size, buffer);
+			return;
+		}
+
+		const auto* record = take(regAddr, size);
+		if (record == nullptr) {
+			memcpy(buffer, m_LastValues[regAddr].data(), size);
+			return;
+		}
+
+		memcpy(buffer, &m_Recording.data[record->offset], size);
+		memcpy(m_LastValues[regAddr].data(), buffer, size);
+		freezeTime(std::max<uint64_t>(micros(), record->micros));
+	}
+
+	void writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final {
+		if (!m_Replaying) {
+			m_Imu.writeBytes(regAddr, size, buffer);
+		}
+	}
+
+	[[nodiscard]] uint8_t getAddress() const final {
+		return m_Recording.header.address;
+	}
+	bool hasSensorOnBus() final { return true; }
+	[[nodiscard]] std::string toString() const final { return "Replay"; }
+
+private:
+	// Replay is timed by when the tracker started each read, while its loop
+	// made its decisions slightly earlier. A periodic read that falls between
+	// the two happens one loop early or late here, so a read that isn't next
+	// is looked for a few records ahead, and reads that aren't in the
+	// recording get the last value read from the same register.
+	static constexpr size_t ResyncWindow = 8;
+
+	const Record* take(uint8_t regAddr, uint8_t size) const {
+		const auto& records = m_Recording.records;
+		const auto end = std::min(m_Next + ResyncWindow, records.size());
+		for (size_t i = m_Next; i < end; i++) {
+			if (records[i].regAddr == regAddr && records[i].size == size) {
+				m_Resyncs += i - m_Next;
+				m_Next = i + 1;
+				return &records[i];
+			}
+		}
+		m_Resyncs++;
+		return nullptr;
+	}
+
+	Sim::SimulatedImu& m_Imu;
+	const Recording& m_Recording;
+	bool m_Replaying = false;
+	mutable size_t m_Next = 0;
+	mutable size_t m_Resyncs = 0;
+	mutable std::array<std::array<uint8_t, 256>, 256> m_LastValues{};
+};
+
+template <typename Device>
+void replay(const Recording& recording, FILE* out) {
+	const auto& header = recording.header;
+	printf(
+		"Replaying %zu reads of %s sensor %d (%s)\n",
+		recording.records.size(),
+		Device::Name,
+		header.sensorId,
+		recording.complete ? "from setup" : "oldest part overwritten"
+	);
+
+	typename Device::Simulator imu(Sim::SimulationConfig{});
+	ReplayRegisterInterface tape(imu, recording);
+
+	// Construct the sensor at the same point of the timeline as on the
+	// tracker, so that the timers it starts line up with the recording
+	freezeTime(header.setupMicros);
+	typename Device::Sensor sensor(header.sensorId, tape, 0.0f);
+	resumeTime();
+	sensor.motionSetup();
+	if (!sensor.isWorking()) {
+		printf("%s failed to initialize\n", Device::Name);
+		return;
+	}
+
+	tape.startReplay();
+	uint32_t updates = 0;
+	Quat rotation = sensor.getFusedRotation();
+	while (!tape.finished()) {
+		const auto position = tape.position();
+		freezeTime(std::max<uint64_t>(micros(), tape.nextMicros()));
+		sensor.motionLoop();
+
+		// The tracker read at this time, but the loop here decided otherwise,
+		// so keep moving forward until it does
+		if (tape.position() == position) {
+			if (micros() > tape.nextMicros() + 1000000) {
+				tape.skip();
+			}
+			freezeTime(micros() + 100);
+			continue;
+		}
+
+		if (sensor.getFusedRotation() != rotation) {
+			rotation = sensor.getFusedRotation();
+			updates++;
+			if (out != nullptr) {
+				fprintf(
+					out,
+					"%llu,%.7f,%.7f,%.7f,%.7f\n",
+					static_cast<unsigned long long>(micros()),
+					rotation.w,
+					rotation.x,
+					rotation.y,
+					rotation.z
+				);
+			}
+		}
+	}
+	resumeTime();
+
+	const auto duration
+		= (recording.records.back().micros - recording.records.front().micros) / 1e6;
+	printf(
+		"%.1f s, %u rotation updates, %zu reads out of order\n",
+		duration,
+		updates,
+		tape.getResyncs()
+	);
+	printf(
+		"Final rotation: w=%.6f x=%.6f y=%.6f z=%.6f\n",
+		rotation.w,
+		rotation.x,
+		rotation.y,
+		rotation.z
+	);
+}
+
+}  // namespace
+
+int runReplay(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	configuration.setup();
+
+	Recording recording;
+	if (!loadRecording(recording)) {
+		fprintf(stderr, "No recording found in %s\n", ImuRecording::Directory);
+		return 1;
+	}
+
+	FILE* out = nullptr;
+	if (args.has("out")) {
+		out = fopen(args.get("out", ""), "w");
+		if (out == nullptr) {
+			fprintf(stderr, "Can't write %s\n", args.get("out", ""));
+			return 1;
+		}
+		fprintf(out, "micros,w,x,y,z\n");
+	}
+
+	bool found = false;
+	Sim::forEachSimulatedDevice("all", [&](auto device) {
+		using Device = decltype(device);
+		if (!found && Device::Sensor::TypeID == recording.header.sensorType) {
+			found = true;
+			replay<Device>(recording, out);
+		}
+	});
+	if (!found) {
+		fprintf(
+			stderr,
+			"Can't replay sensor type %d, only SoftFusion IMUs are supported\n",
+			static_cast<int>(recording.header.sensorType)
+		);
+	}
+
+	if (out != nullptr) {
+		fclose(out);
+	}
+	return found ? 0 : 1;
+}
+
+}  // namespace SlimeVR::Native
@@ -0,0 +1,65 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `server` tool: a stand-in for the SlimeVR server that reports the throughput
+// of the trackers streaming to it, on the local network or in a native build.
+
+#include <Arduino.h>
+
+#include <cstdlib>
+
+#include "MockServer.h"
+#include "arguments.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+int runMockServer(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	const auto seconds = strtoul(args.positional(0, "0"), nullptr, 10);
+	const auto port = static_cast<uint16_t>(args.get("port", 6969L));
+	const auto reportMillis = static_cast<uint32_t>(args.get("report", 5L)) * 1000;
+
+	MockServer server(port);
+	if (!server.begin()) {
+		fprintf(stderr, "Can't listen on UDP port %u\n", port);
+		return 1;
+	}
+	printf("Listening on UDP port %u\n", port);
+
+	const auto start = millis();
+	auto lastReport = start;
+	while (seconds == 0 || millis() - start < seconds * 1000) {
+		server.update(10);
+
+		if (millis() - lastReport >= reportMillis) {
+			lastReport = millis();
+			server.printStats();
+			server.resetStats();
+		}
+	}
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
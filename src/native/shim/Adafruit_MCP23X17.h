@@ -1,14 +1,17 @@
 /*
 	SlimeVR Code is placed under the MIT license
-	Copyright (c) 2025 Gorbit99 & SlimeVR Contributors
+	Copyright (c) 2025 SlimeVR Contributors
+
 	Permission is hereby granted, free of charge, to any person obtaining a copy
 	of this software and associated documentation files (the "Software"), to deal
 	in the Software without restriction, including without limitation the rights
 	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
 	copies of the Software, and to permit persons to whom the Software is
 	furnished to do so, subject to the following conditions:
+
 	The above copyright notice and this permission notice shall be included in
 	all copies or substantial portions of the Software.
+
 	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
 	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
 	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -20,39 +23,15 @@
 
 #pragma once
 
-#include <cstdint>
-
-#include "logging/Logger.h"
+#include <Wire.h>
 
-namespace SlimeVR::Debugging {
+#include <cstdint>
 
-/*
- * Usage:
- *
- * TimeTakenMeasurer measurer{"Some event"};
- *
- * ...
- *
- * measurer.before();
- * thing to measure
- * measurer.after();
- */
-class TimeTakenMeasurer {
+// No GPIO expander on the host; begin_I2C() fails like with nothing on the bus
+class Adafruit_MCP23X17 {
 public:
-	explicit TimeTakenMeasurer(const char* name);
-	void before();
-	void after();
-
-private:
-	static constexpr float SecondsBetweenReports = 1.0f;
-
-	const char* name;
-	SlimeVR::Logging::Logger m_Logger = SlimeVR::Logging::Logger("TimeTaken");
-
-	uint64_t lastTimeTakenReportMillis = 0;
-	uint64_t timeTakenMicros = 0;
-
-	uint64_t startMicros = 0;
+	bool begin_I2C(uint8_t address = 0x20, TwoWire* wire = &Wire) { return false; }
+	void pinMode(uint8_t pin, uint8_t mode) {}
+	uint8_t digitalRead(uint8_t pin) { return LOW; }
+	void digitalWrite(uint8_t pin, uint8_t value) {}
 };
-
-}  // namespace SlimeVR::Debugging
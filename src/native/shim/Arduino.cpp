@@ -0,0 +1,239 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include <Wire.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+#include "../clock.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+TwoWire Wire;
+TwoWire Wire1;
+SPIClass SPI;
+WiFiClass WiFi;
+
+namespace {
+const auto startTime = std::chrono::steady_clock::now();
+std::mt19937 randomEngine;
+
+uint64_t realMicros() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			   std::chrono::steady_clock::now() - startTime
+	)
+		.count();
+}
+
+// See native/clock.h
+bool timeFrozen = false;
+uint64_t frozenMicros = 0;
+int64_t clockOffsetMicros = 0;
+}  // namespace
+
+void SlimeVR::Native::freezeTime(uint64_t micros) {
+	timeFrozen = true;
+	frozenMicros = micros;
+}
+
+void SlimeVR::Native::resumeTime() {
+	if (timeFrozen) {
+		clockOffsetMicros = frozenMicros - realMicros();
+		timeFrozen = false;
+	}
+}
+
+void SlimeVR::Native::advanceTime(uint64_t micros) {
+	if (timeFrozen) {
+		frozenMicros += micros;
+	} else {
+		clockOffsetMicros += micros;
+	}
+}
+
+unsigned long millis() { return micros() / 1000; }
+
+unsigned long micros() {
+	return timeFrozen ? frozenMicros : realMicros() + clockOffsetMicros;
+}
+
+void delay(unsigned long ms) {
+	if (timeFrozen) {
+		frozenMicros += ms * 1000;
+		return;
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Busy-waits like the ESP cores do; sleeping would overshoot short delays by
+// far more than the delay itself.
+void delayMicroseconds(unsigned int us) {
+	if (timeFrozen) {
+		frozenMicros += us;
+		return;
+	}
+	auto start = micros();
+	while (micros() - start < us) {
+	}
+}
+
+void yield() {}
+
+bool optimistic_yield(uint32_t interval_us) { return false; }
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t val) {}
+int digitalRead(uint8_t pin) { return LOW; }
+int analogRead(uint8_t pin) { return 0; }
+void analogWrite(uint8_t pin, int val) {}
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {}
+void detachInterrupt(uint8_t pin) {}
+
+long random(long max) { return max > 0 ? random(0, max) : 0; }
+
+long random(long min, long max) {
+	if (max <= min) {
+		return min;
+	}
+	return std::uniform_int_distribution<long>(min, max - 1)(randomEngine);
+}
+
+void randomSeed(unsigned long seed) { randomEngine.seed(seed); }
+
+size_t Print::printf(const char* format, ...) {
+	char buf[256];
+	va_list args;
+	va_start(args, format);
+	int len = vsnprintf(buf, sizeof(buf), format, args);
+	va_end(args);
+
+	if (len < 0) {
+		return 0;
+	}
+	if (static_cast<size_t>(len) < sizeof(buf)) {
+		return write(reinterpret_cast<const uint8_t*>(buf), len);
+	}
+
+	std::string str(len, '\0');
+	va_start(args, format);
+	vsnprintf(str.data(), len + 1, format, args);
+	va_end(args);
+	return write(reinterpret_cast<const uint8_t*>(str.data()), len);
+}
+
+size_t Print::print(long n, int base) {
+	if (base == 10) {
+		return printf("%ld", n);
+	}
+	return print(static_cast<unsigned long>(n), base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+	switch (base) {
+		case 16:
+			return printf("%lX", n);
+		case 8:
+			return printf("%lo", n);
+		case 2: {
+			char buf[sizeof(n) * 8 + 1];
+			char* str = &buf[sizeof(buf) - 1];
+			*str = '\0';
+			do {
+				*--str = '0' + (n & 1);
+				n >>= 1;
+			} while (n);
+			return write(str);
+		}
+		default:
+			return printf("%lu", n);
+	}
+}
+
+size_t Print::print(double n, int digits) { return printf("%.*f", digits, n); }
+
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+	size_t count = 0;
+	auto start = millis();
+	while (count < length && millis() - start < m_Timeout) {
+		int c = read();
+		if (c < 0) {
+			delay(1);
+			continue;
+		}
+		buffer[count++] = static_cast<uint8_t>(c);
+	}
+	return count;
+}
+
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+	return fwrite(buffer, 1, size, stdout);
+}
+
+void HardwareSerial::flush() { fflush(stdout); }
+
+int HardwareSerial::available() {
+	if (peek() < 0) {
+		return 0;
+	}
+	return 1;
+}
+
+int HardwareSerial::read() {
+	int c = peek();
+	if (c >= 0) {
+		m_Peeked = -1;
+	}
+	return c;
+}
+
+int HardwareSerial::peek() {
+	if (m_Peeked >= 0) {
+		return m_Peeked;
+	}
+
+	pollfd fd{STDIN_FILENO, POLLIN, 0};
+	if (poll(&fd, 1, 0) <= 0 || !(fd.revents & POLLIN)) {
+		return -1;
+	}
+
+	uint8_t c;
+	if (::read(STDIN_FILENO, &c, 1) != 1) {
+		return -1;
+	}
+	m_Peeked = c;
+	return m_Peeked;
+}
+
+void EspClass::restart() {
+	Serial.flush();
+	exit(0);
+}
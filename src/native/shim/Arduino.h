@@ -0,0 +1,232 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// Minimal subset of the Arduino core used by the tracker, for the native host
+// build. Only what the firmware actually touches is provided; everything that
+// talks to hardware is a no-op.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "WString.h"
+#include "pgmspace.h"
+#include "pins_arduino.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x00
+#define OUTPUT 0x01
+#define INPUT_PULLUP 0x02
+#define INPUT_PULLDOWN 0x04
+#define OUTPUT_OPEN_DRAIN 0x03
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define ICACHE_FLASH_ATTR
+
+#define digitalPinToInterrupt(p) (p)
+#define bit(b) (1UL << (b))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define lowByte(w) ((uint8_t)((w)&0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+
+using std::max;
+using std::min;
+
+template <typename T, typename L, typename H>
+constexpr auto constrain(T amt, L low, H high) {
+	return amt < low ? low : (amt > high ? high : amt);
+}
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+	return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+inline char* dtostrf(double number, signed char width, unsigned char prec, char* s) {
+	sprintf(s, "%*.*f", width, prec, number);
+	return s;
+}
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+bool optimistic_yield(uint32_t interval_us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+class Print {
+public:
+	virtual ~Print() = default;
+
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size) {
+		size_t n = 0;
+		while (size--) {
+			n += write(*buffer++);
+		}
+		return n;
+	}
+	size_t write(const char* str) {
+		return write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+	}
+	virtual void flush() {}
+
+	size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+	size_t print(const char* str) { return write(str); }
+	size_t print(const __FlashStringHelper* str) {
+		return write(reinterpret_cast<const char*>(str));
+	}
+	size_t print(const String& str) { return write(str.c_str()); }
+	size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+	size_t print(int n, int base = 10) { return print(static_cast<long>(n), base); }
+	size_t print(unsigned int n, int base = 10) {
+		return print(static_cast<unsigned long>(n), base);
+	}
+	size_t print(long n, int base = 10);
+	size_t print(unsigned long n, int base = 10);
+	size_t print(unsigned char n, int base = 10) {
+		return print(static_cast<unsigned long>(n), base);
+	}
+	size_t print(double n, int digits = 2);
+
+	template <typename T>
+	size_t println(T value) {
+		size_t n = print(value);
+		return n + println();
+	}
+	template <typename T>
+	size_t println(T value, int format) {
+		size_t n = print(value, format);
+		return n + println();
+	}
+	size_t println() { return write("\r\n"); }
+};
+
+class Stream : public Print {
+public:
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+
+	void setTimeout(unsigned long timeout) { m_Timeout = timeout; }
+	size_t readBytes(uint8_t* buffer, size_t length);
+
+protected:
+	unsigned long m_Timeout = 1000;
+};
+
+// Serial port backed by the process' stdout/stdin
+class HardwareSerial : public Stream {
+public:
+	void begin(unsigned long) {}
+	void end() {}
+	operator bool() const { return true; }
+
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	using Print::write;
+	void flush() override;
+
+	int available() override;
+	int read() override;
+	int peek() override;
+
+private:
+	int m_Peeked = -1;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+	void restart();
+	void reset() { restart(); }
+	void deepSleep(uint64_t) { restart(); }
+	void wdtFeed() {}
+	void wdtEnable(uint32_t) {}
+	void wdtDisable() {}
+	uint16_t getVcc() { return 3300; }
+	uint32_t getFreeHeap() { return 0; }
+	uint32_t getMaxFreeBlockSize() { return 0; }
+	uint32_t getFreeContStack() { return 0; }
+	uint32_t getChipId() { return 0; }
+	uint32_t getCpuFreqMHz() { return 0; }
+	const char* getSdkVersion() { return "native"; }
+	String getResetReason() { return "native"; }
+	void rtcUserMemoryRead(uint32_t, uint32_t*, size_t) {}
+	void rtcUserMemoryWrite(uint32_t, uint32_t*, size_t) {}
+};
+
+extern EspClass ESP;
@@ -0,0 +1,83 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#include "WString.h"
+
+class IPAddress {
+public:
+	IPAddress() = default;
+	IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+		: m_Octets{a, b, c, d} {}
+	explicit IPAddress(uint32_t address) {
+		for (int i = 0; i < 4; i++) {
+			m_Octets[i] = (address >> (i * 8)) & 0xff;
+		}
+	}
+
+	bool fromString(const char* address) {
+		unsigned int a, b, c, d;
+		if (sscanf(address, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255
+			|| c > 255 || d > 255) {
+			return false;
+		}
+		*this = IPAddress(a, b, c, d);
+		return true;
+	}
+	bool fromString(const String& address) { return fromString(address.c_str()); }
+
+	String toString() const {
+		char buf[16];
+		snprintf(
+			buf,
+			sizeof(buf),
+			"%u.%u.%u.%u",
+			m_Octets[0],
+			m_Octets[1],
+			m_Octets[2],
+			m_Octets[3]
+		);
+		return buf;
+	}
+
+	// Network byte order, same as the ESP cores
+	operator uint32_t() const {
+		return m_Octets[0] | m_Octets[1] << 8 | m_Octets[2] << 16
+			 | static_cast<uint32_t>(m_Octets[3]) << 24;
+	}
+	uint8_t operator[](int index) const { return m_Octets[index]; }
+	uint8_t& operator[](int index) { return m_Octets[index]; }
+	bool operator==(const IPAddress& other) const {
+		return static_cast<uint32_t>(*this) == static_cast<uint32_t>(other);
+	}
+	bool operator!=(const IPAddress& other) const { return !(*this == other); }
+
+private:
+	uint8_t m_Octets[4]{};
+};
+
+#define INADDR_NONE IPAddress(0, 0, 0, 0)
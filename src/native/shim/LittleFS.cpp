@@ -0,0 +1,275 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include <LittleFS.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
+
+fs::FS LittleFS;
+
+namespace fs {
+
+namespace stdfs = std::filesystem;
+
+struct File::Handle {
+	~Handle() {
+		if (file) {
+			fclose(file);
+		}
+	}
+
+	FILE* file = nullptr;
+	std::string path;
+	std::string name;
+	bool directory = false;
+};
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+	if (!m_Handle || !m_Handle->file) {
+		return 0;
+	}
+	return fwrite(buffer, 1, size, m_Handle->file);
+}
+
+int File::available() {
+	if (!m_Handle || !m_Handle->file) {
+		return 0;
+	}
+	return static_cast<int>(size() - position());
+}
+
+int File::read() {
+	uint8_t c;
+	return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+	if (!m_Handle || !m_Handle->file) {
+		return 0;
+	}
+	return fread(buffer, 1, size, m_Handle->file);
+}
+
+int File::peek() {
+	if (!m_Handle || !m_Handle->file) {
+		return -1;
+	}
+	int c = fgetc(m_Handle->file);
+	if (c != EOF) {
+		ungetc(c, m_Handle->file);
+	}
+	return c == EOF ? -1 : c;
+}
+
+void File::flush() {
+	if (m_Handle && m_Handle->file) {
+		fflush(m_Handle->file);
+	}
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+	if (!m_Handle || !m_Handle->file) {
+		return false;
+	}
+	int whence = mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END);
+	return fseek(m_Handle->file, pos, whence) == 0;
+}
+
+size_t File::position() const {
+	if (!m_Handle || !m_Handle->file) {
+		return 0;
+	}
+	return ftell(m_Handle->file);
+}
+
+size_t File::size() const {
+	if (!m_Handle || m_Handle->directory) {
+		return 0;
+	}
+	if (m_Handle->file) {
+		fflush(m_Handle->file);
+	}
+	std::error_code ec;
+	auto size = stdfs::file_size(m_Handle->path, ec);
+	return ec ? 0 : size;
+}
+
+void File::close() { m_Handle.reset(); }
+
+const char* File::name() const { return m_Handle ? m_Handle->name.c_str() : ""; }
+
+const char* File::fullName() const { return m_Handle ? m_Handle->path.c_str() : ""; }
+
+bool File::isFile() const { return m_Handle && !m_Handle->directory; }
+
+bool File::isDirectory() const { return m_Handle && m_Handle->directory; }
+
+bool Dir::next() {
+	if (m_Index + 1 >= static_cast<int>(m_Entries.size())) {
+		return false;
+	}
+	m_Index++;
+	return true;
+}
+
+bool Dir::rewind() {
+	m_Index = -1;
+	return true;
+}
+
+String Dir::fileName() const {
+	if (m_Index < 0) {
+		return "";
+	}
+	return m_Entries[m_Index].c_str();
+}
+
+size_t Dir::fileSize() const {
+	if (m_Index < 0) {
+		return 0;
+	}
+	std::error_code ec;
+	auto size = stdfs::file_size(stdfs::path(m_Path) / m_Entries[m_Index], ec);
+	return ec ? 0 : size;
+}
+
+bool Dir::isFile() const {
+	return m_Index >= 0
+		&& stdfs::is_regular_file(stdfs::path(m_Path) / m_Entries[m_Index]);
+}
+
+bool Dir::isDirectory() const {
+	return m_Index >= 0
+		&& stdfs::is_directory(stdfs::path(m_Path) / m_Entries[m_Index]);
+}
+
+File Dir::openFile(const char* mode) const {
+	if (m_Index < 0) {
+		return File();
+	}
+
+	auto handle = std::make_shared<File::Handle>();
+	auto path = stdfs::path(m_Path) / m_Entries[m_Index];
+	handle->path = path.string();
+	handle->name = m_Entries[m_Index];
+	handle->directory = stdfs::is_directory(path);
+	if (!handle->directory) {
+		std::string fmode = mode;
+		handle->file = fopen(handle->path.c_str(), (fmode + "b").c_str());
+		if (!handle->file) {
+			return File();
+		}
+	}
+	return File(handle);
+}
+
+bool FS::begin() {
+	const char* root = getenv("SLIMEVR_NATIVE_FS");
+	m_Root = root ? root : ".littlefs";
+
+	std::error_code ec;
+	stdfs::create_directories(m_Root, ec);
+	return stdfs::is_directory(m_Root, ec);
+}
+
+bool FS::format() {
+	std::error_code ec;
+	stdfs::remove_all(m_Root, ec);
+	stdfs::create_directories(m_Root, ec);
+	return !ec;
+}
+
+std::string FS::hostPath(const char* path) const {
+	while (*path == '/') {
+		path++;
+	}
+	return (stdfs::path(m_Root) / path).string();
+}
+
+File FS::open(const char* path, const char* mode) {
+	auto handle = std::make_shared<File::Handle>();
+	handle->path = hostPath(path);
+	handle->name = stdfs::path(handle->path).filename().string();
+
+	if (stdfs::is_directory(handle->path)) {
+		handle->directory = true;
+		return File(handle);
+	}
+
+	// LittleFS creates missing parent directories when writing
+	std::string fmode = mode;
+	if (fmode[0] != 'r') {
+		std::error_code ec;
+		stdfs::create_directories(stdfs::path(handle->path).parent_path(), ec);
+	}
+
+	handle->file = fopen(handle->path.c_str(), (fmode + "b").c_str());
+	if (!handle->file) {
+		return File();
+	}
+	return File(handle);
+}
+
+Dir FS::openDir(const char* path) {
+	std::vector<std::string> entries;
+	std::error_code ec;
+	auto hostDir = hostPath(path);
+	for (auto& entry : stdfs::directory_iterator(hostDir, ec)) {
+		entries.push_back(entry.path().filename().string());
+	}
+	std::sort(entries.begin(), entries.end());
+	return Dir(hostDir, std::move(entries));
+}
+
+bool FS::exists(const char* path) {
+	std::error_code ec;
+	return stdfs::exists(hostPath(path), ec);
+}
+
+bool FS::remove(const char* path) {
+	std::error_code ec;
+	return stdfs::is_regular_file(hostPath(path), ec)
+		&& stdfs::remove(hostPath(path), ec);
+}
+
+bool FS::rename(const char* from, const char* to) {
+	std::error_code ec;
+	stdfs::rename(hostPath(from), hostPath(to), ec);
+	return !ec;
+}
+
+bool FS::mkdir(const char* path) {
+	std::error_code ec;
+	stdfs::create_directories(hostPath(path), ec);
+	return !ec;
+}
+
+bool FS::rmdir(const char* path) {
+	std::error_code ec;
+	return stdfs::remove_all(hostPath(path), ec) > 0;
+}
+
+}  // namespace fs
@@ -0,0 +1,132 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+
+// LittleFS mapped onto a directory of the host filesystem. The root defaults to
+// "./.littlefs" and can be moved with the SLIMEVR_NATIVE_FS environment
+// variable. Only the ESP8266 flavour of the API (openDir) is provided, as the
+// native build is neither ESP8266 nor ESP32 and FSHelper picks that one.
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+public:
+	File() = default;
+
+	size_t write(uint8_t c) override { return write(&c, 1); }
+	size_t write(const uint8_t* buffer, size_t size) override;
+	using Print::write;
+	int available() override;
+	int read() override;
+	size_t read(uint8_t* buffer, size_t size);
+	int peek() override;
+	void flush() override;
+
+	bool seek(uint32_t pos, SeekMode mode = SeekSet);
+	size_t position() const;
+	size_t size() const;
+	void close();
+	operator bool() const { return m_Handle != nullptr; }
+
+	const char* name() const;
+	const char* fullName() const;
+	bool isFile() const;
+	bool isDirectory() const;
+
+private:
+	struct Handle;
+	explicit File(std::shared_ptr<Handle> handle)
+		: m_Handle(std::move(handle)) {}
+
+	std::shared_ptr<Handle> m_Handle;
+
+	friend class FS;
+	friend class Dir;
+};
+
+class Dir {
+public:
+	bool next();
+	bool rewind();
+	String fileName() const;
+	size_t fileSize() const;
+	bool isFile() const;
+	bool isDirectory() const;
+	File openFile(const char* mode) const;
+
+private:
+	Dir(std::string path, std::vector<std::string> entries)
+		: m_Path(std::move(path))
+		, m_Entries(std::move(entries)) {}
+
+	std::string m_Path;
+	std::vector<std::string> m_Entries;
+	int m_Index = -1;
+
+	friend class FS;
+};
+
+class FS {
+public:
+	bool begin();
+	void end() {}
+	bool format();
+
+	File open(const char* path, const char* mode = "r");
+	File open(const String& path, const char* mode = "r") {
+		return open(path.c_str(), mode);
+	}
+	Dir openDir(const char* path);
+	bool exists(const char* path);
+	bool exists(const String& path) { return exists(path.c_str()); }
+	bool remove(const char* path);
+	bool remove(const String& path) { return remove(path.c_str()); }
+	bool rename(const char* from, const char* to);
+	bool mkdir(const char* path);
+	bool rmdir(const char* path);
+
+	// Host path backing the given LittleFS path
+	std::string hostPath(const char* path) const;
+
+private:
+	std::string m_Root;
+};
+
+}  // namespace fs
+
+using fs::Dir;
+using fs::File;
+using fs::FS;
+
+extern fs::FS LittleFS;
@@ -0,0 +1,75 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPISettings {
+public:
+	SPISettings() = default;
+	SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+		: _clock(clock)
+		, _bitOrder(bitOrder)
+		, _dataMode(dataMode) {}
+
+	uint32_t _clock = 1000000;
+	uint8_t _bitOrder = MSBFIRST;
+	uint8_t _dataMode = SPI_MODE0;
+};
+
+// Host SPIClass. Nothing is ever connected, so reads return 0xff like a floating
+// MISO line would.
+class SPIClass {
+public:
+	void begin() {}
+	void begin(int8_t sck, int8_t miso, int8_t mosi, int8_t ss) {}
+	void end() {}
+	void beginTransaction(SPISettings settings) {}
+	void endTransaction() {}
+	void setFrequency(uint32_t) {}
+	void setDataMode(uint8_t) {}
+	void setBitOrder(uint8_t) {}
+
+	uint8_t transfer(uint8_t) { return 0xff; }
+	uint16_t transfer16(uint16_t) { return 0xffff; }
+	void transfer(void* data, uint32_t size) {
+		memset(data, 0xff, size);
+	}
+	void transferBytes(const uint8_t* out, uint8_t* in, uint32_t size) {
+		if (in) {
+			memset(in, 0xff, size);
+		}
+	}
+	void writeBytes(const uint8_t*, uint32_t) {}
+};
+
+extern SPIClass SPI;
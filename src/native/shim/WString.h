@@ -0,0 +1,136 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdlib>
+#include <string>
+
+class __FlashStringHelper;
+
+// Arduino String on top of std::string, just wide enough for the tracker code
+class String {
+public:
+	String() = default;
+	String(const char* str)
+		: m_Str(str ? str : "") {}
+	String(const __FlashStringHelper* str)
+		: String(reinterpret_cast<const char*>(str)) {}
+	String(const std::string& str)
+		: m_Str(str) {}
+	String(char c)
+		: m_Str(1, c) {}
+	String(int value)
+		: m_Str(std::to_string(value)) {}
+	String(unsigned int value)
+		: m_Str(std::to_string(value)) {}
+	String(long value)
+		: m_Str(std::to_string(value)) {}
+	String(unsigned long value)
+		: m_Str(std::to_string(value)) {}
+	String(float value, unsigned int decimals = 2)
+		: m_Str(format(value, decimals)) {}
+	String(double value, unsigned int decimals = 2)
+		: m_Str(format(value, decimals)) {}
+
+	const char* c_str() const { return m_Str.c_str(); }
+	unsigned int length() const { return m_Str.length(); }
+	bool isEmpty() const { return m_Str.empty(); }
+
+	char charAt(unsigned int index) const { return m_Str.at(index); }
+	char operator[](unsigned int index) const { return m_Str[index]; }
+
+	int indexOf(char c, unsigned int from = 0) const {
+		auto pos = m_Str.find(c, from);
+		return pos == std::string::npos ? -1 : static_cast<int>(pos);
+	}
+	int indexOf(const String& str, unsigned int from = 0) const {
+		auto pos = m_Str.find(str.m_Str, from);
+		return pos == std::string::npos ? -1 : static_cast<int>(pos);
+	}
+	String substring(unsigned int from) const { return m_Str.substr(from); }
+	String substring(unsigned int from, unsigned int to) const {
+		return m_Str.substr(from, to - from);
+	}
+	bool startsWith(const String& prefix) const {
+		return m_Str.rfind(prefix.m_Str, 0) == 0;
+	}
+	bool endsWith(const String& suffix) const {
+		return m_Str.size() >= suffix.m_Str.size()
+			&& m_Str.compare(
+				   m_Str.size() - suffix.m_Str.size(),
+				   suffix.m_Str.size(),
+				   suffix.m_Str
+			   ) == 0;
+	}
+	bool equals(const String& other) const { return m_Str == other.m_Str; }
+	long toInt() const { return std::strtol(m_Str.c_str(), nullptr, 10); }
+	float toFloat() const { return std::strtof(m_Str.c_str(), nullptr); }
+	void trim() {
+		auto begin = m_Str.find_first_not_of(" \t\r\n");
+		auto end = m_Str.find_last_not_of(" \t\r\n");
+		m_Str = begin == std::string::npos ? "" : m_Str.substr(begin, end - begin + 1);
+	}
+
+	String& operator+=(const String& other) {
+		m_Str += other.m_Str;
+		return *this;
+	}
+	String& operator+=(const char* other) {
+		m_Str += other;
+		return *this;
+	}
+	String& operator+=(char c) {
+		m_Str += c;
+		return *this;
+	}
+	bool concat(const String& other) {
+		m_Str += other.m_Str;
+		return true;
+	}
+
+	friend String operator+(const String& lhs, const String& rhs) {
+		return lhs.m_Str + rhs.m_Str;
+	}
+	friend String operator+(const String& lhs, const char* rhs) {
+		return lhs.m_Str + rhs;
+	}
+	friend String operator+(const char* lhs, const String& rhs) {
+		return lhs + rhs.m_Str;
+	}
+	bool operator==(const String& other) const { return m_Str == other.m_Str; }
+	bool operator==(const char* other) const { return m_Str == other; }
+	bool operator!=(const String& other) const { return m_Str != other.m_Str; }
+	bool operator<(const String& other) const { return m_Str < other.m_Str; }
+
+private:
+	static std::string format(double value, unsigned int decimals) {
+		char buf[64];
+		snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+		return buf;
+	}
+
+	std::string m_Str;
+};
+
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
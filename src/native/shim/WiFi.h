@@ -0,0 +1,60 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+typedef enum {
+	WL_NO_SHIELD = 255,
+	WL_IDLE_STATUS = 0,
+	WL_NO_SSID_AVAIL = 1,
+	WL_SCAN_COMPLETED = 2,
+	WL_CONNECTED = 3,
+	WL_CONNECT_FAILED = 4,
+	WL_CONNECTION_LOST = 5,
+	WL_WRONG_PASSWORD = 6,
+	WL_DISCONNECTED = 7,
+} wl_status_t;
+
+// The host is always "connected" to the network through loopback
+class WiFiClass {
+public:
+	wl_status_t status() const { return WL_CONNECTED; }
+	bool isConnected() const { return true; }
+	IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+	int32_t RSSI() const { return -40; }
+	String SSID() const { return "native"; }
+
+	uint8_t* macAddress(uint8_t* mac) const {
+		static constexpr uint8_t NativeMac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+		memcpy(mac, NativeMac, sizeof(NativeMac));
+		return mac;
+	}
+	String macAddress() const { return "02:00:00:00:00:01"; }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,184 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include <WiFiUdp.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace {
+sockaddr_in toSockaddr(IPAddress ip, uint16_t port) {
+	sockaddr_in addr{};
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr.s_addr = static_cast<uint32_t>(ip);
+	return addr;
+}
+}  // namespace
+
+WiFiUDP::~WiFiUDP() { stop(); }
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+	stop();
+
+	m_Socket = socket(AF_INET, SOCK_DGRAM, 0);
+	if (m_Socket < 0) {
+		return 0;
+	}
+	fcntl(m_Socket, F_SETFL, fcntl(m_Socket, F_GETFL) | O_NONBLOCK);
+
+	auto addr = toSockaddr(IPAddress(0, 0, 0, 0), port);
+	if (bind(m_Socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+		if (errno != EADDRINUSE) {
+			stop();
+			return 0;
+		}
+		addr.sin_port = 0;
+		if (bind(m_Socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+			stop();
+			return 0;
+		}
+	}
+
+	socklen_t len = sizeof(addr);
+	getsockname(m_Socket, reinterpret_cast<sockaddr*>(&addr), &len);
+	m_LocalPort = ntohs(addr.sin_port);
+	return 1;
+}
+
+void WiFiUDP::stop() {
+	if (m_Socket >= 0) {
+		close(m_Socket);
+	}
+	m_Socket = -1;
+	m_LocalPort = 0;
+	m_RxLength = 0;
+	m_RxPosition = 0;
+	m_TxActive = false;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+	if (m_Socket < 0 && !begin(0)) {
+		return 0;
+	}
+
+	if (ip == IPAddress(255, 255, 255, 255)) {
+		ip = IPAddress(127, 0, 0, 1);
+	}
+
+	m_TxIP = ip;
+	m_TxPort = port;
+	m_TxLength = 0;
+	m_TxActive = true;
+	return 1;
+}
+
+int WiFiUDP::endPacket() {
+	if (!m_TxActive) {
+		return 0;
+	}
+	m_TxActive = false;
+
+	auto addr = toSockaddr(m_TxIP, m_TxPort);
+	auto sent = sendto(
+		m_Socket,
+		m_TxBuffer,
+		m_TxLength,
+		0,
+		reinterpret_cast<sockaddr*>(&addr),
+		sizeof(addr)
+	);
+	if (sent != static_cast<ssize_t>(m_TxLength)) {
+		m_WriteError = 1;
+		return 0;
+	}
+	return 1;
+}
+
+size_t WiFiUDP::write(uint8_t data) { return write(&data, 1); }
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size) {
+	if (!m_TxActive) {
+		return 0;
+	}
+	size = std::min(size, MaxPacketSize - m_TxLength);
+	memcpy(m_TxBuffer + m_TxLength, buffer, size);
+	m_TxLength += size;
+	return size;
+}
+
+int WiFiUDP::parsePacket() {
+	m_RxLength = 0;
+	m_RxPosition = 0;
+
+	if (m_Socket < 0) {
+		return 0;
+	}
+
+	sockaddr_in addr{};
+	socklen_t len = sizeof(addr);
+	auto received = recvfrom(
+		m_Socket,
+		m_RxBuffer,
+		sizeof(m_RxBuffer),
+		0,
+		reinterpret_cast<sockaddr*>(&addr),
+		&len
+	);
+	if (received <= 0) {
+		return 0;
+	}
+
+	m_RemoteIP = IPAddress(addr.sin_addr.s_addr);
+	m_RemotePort = ntohs(addr.sin_port);
+	m_RxLength = received;
+	return static_cast<int>(received);
+}
+
+int WiFiUDP::available() { return static_cast<int>(m_RxLength - m_RxPosition); }
+
+int WiFiUDP::read() {
+	if (m_RxPosition >= m_RxLength) {
+		return -1;
+	}
+	return m_RxBuffer[m_RxPosition++];
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t length) {
+	length = std::min(length, m_RxLength - m_RxPosition);
+	memcpy(buffer, m_RxBuffer + m_RxPosition, length);
+	m_RxPosition += length;
+	return static_cast<int>(length);
+}
+
+int WiFiUDP::peek() {
+	if (m_RxPosition >= m_RxLength) {
+		return -1;
+	}
+	return m_RxBuffer[m_RxPosition];
+}
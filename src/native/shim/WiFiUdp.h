@@ -0,0 +1,86 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+// WiFiUDP on top of a non-blocking POSIX UDP socket.
+//
+// Packets sent to the limited broadcast address go to 127.0.0.1 instead, so a
+// server running on the same machine can be discovered. If the requested local
+// port is taken (typically by that server), an ephemeral port is used.
+class WiFiUDP : public Stream {
+public:
+	WiFiUDP() = default;
+	WiFiUDP(const WiFiUDP&) = delete;
+	WiFiUDP& operator=(const WiFiUDP&) = delete;
+	~WiFiUDP() override;
+
+	uint8_t begin(uint16_t port);
+	void stop();
+	uint16_t localPort() const { return m_LocalPort; }
+
+	int beginPacket(IPAddress ip, uint16_t port);
+	int endPacket();
+	size_t write(uint8_t data) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	using Print::write;
+	int getWriteError() const { return m_WriteError; }
+
+	int parsePacket();
+	int available() override;
+	int read() override;
+	int read(uint8_t* buffer, size_t length);
+	int read(char* buffer, size_t length) {
+		return read(reinterpret_cast<uint8_t*>(buffer), length);
+	}
+	int peek() override;
+	void flush() override {}
+
+	IPAddress remoteIP() const { return m_RemoteIP; }
+	uint16_t remotePort() const { return m_RemotePort; }
+
+private:
+	static constexpr size_t MaxPacketSize = 1472;
+
+	int m_Socket = -1;
+	uint16_t m_LocalPort = 0;
+	int m_WriteError = 0;
+
+	IPAddress m_TxIP;
+	uint16_t m_TxPort = 0;
+	uint8_t m_TxBuffer[MaxPacketSize]{};
+	size_t m_TxLength = 0;
+	bool m_TxActive = false;
+
+	IPAddress m_RemoteIP;
+	uint16_t m_RemotePort = 0;
+	uint8_t m_RxBuffer[MaxPacketSize]{};
+	size_t m_RxLength = 0;
+	size_t m_RxPosition = 0;
+};
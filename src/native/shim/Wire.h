@@ -0,0 +1,120 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+// Something answering writes on the host bus, like a simulated I2C mux
+class WireDevice {
+public:
+	virtual ~WireDevice() = default;
+	virtual void receive(const uint8_t* data, size_t size) = 0;
+};
+
+// Host TwoWire. There is no bus on the host, so every address NACKs unless a
+// WireDevice was attached to it.
+class TwoWire : public Stream {
+public:
+	void attach(uint8_t address, WireDevice* device) { m_Devices[address] = device; }
+	void detach(uint8_t address) { m_Devices[address] = nullptr; }
+
+
+	void begin() {}
+	void begin(int sda, int scl) {}
+	void begin(int sda, int scl, uint32_t frequency) { setClock(frequency); }
+	void end() {}
+	void setClock(uint32_t frequency) { m_Clock = frequency; }
+	uint32_t getClock() const { return m_Clock; }
+	void setClockStretchLimit(uint32_t) {}
+	void setTimeOut(uint16_t timeout) { m_TimeOut = timeout; }
+	uint16_t getTimeOut() const { return m_TimeOut; }
+
+	void beginTransmission(uint8_t address) {
+		m_Transmitting = true;
+		m_Address = address & 0x7f;
+		m_Length = 0;
+	}
+	void beginTransmission(int address) {
+		beginTransmission(static_cast<uint8_t>(address));
+	}
+	// 2 is "NACK on address", same as an empty bus on the real cores
+	uint8_t endTransmission(bool sendStop = true) {
+		m_Transmitting = false;
+		if (m_Devices[m_Address] == nullptr) {
+			return 2;
+		}
+		m_Devices[m_Address]->receive(m_Buffer, m_Length);
+		return 0;
+	}
+
+	uint8_t requestFrom(uint8_t address, size_t quantity, bool sendStop = true) {
+		return 0;
+	}
+	uint8_t requestFrom(int address, int quantity, int sendStop = 1) {
+		return requestFrom(
+			static_cast<uint8_t>(address),
+			static_cast<size_t>(quantity),
+			sendStop != 0
+		);
+	}
+
+	size_t write(uint8_t data) override { return write(&data, 1); }
+	size_t write(const uint8_t* data, size_t quantity) override {
+		if (!m_Transmitting) {
+			return 0;
+		}
+		quantity = std::min(quantity, sizeof(m_Buffer) - m_Length);
+		std::copy(data, data + quantity, m_Buffer + m_Length);
+		m_Length += quantity;
+		return quantity;
+	}
+	using Print::write;
+	int available() override { return 0; }
+	int read() override { return -1; }
+	int peek() override { return -1; }
+	void flush() override {}
+
+	// Legacy Wire API still used by i2cdevlib
+	size_t send(uint8_t data) { return write(data); }
+	int receive() { return read(); }
+
+private:
+	uint32_t m_Clock = 100000;
+	uint16_t m_TimeOut = 50;
+
+	bool m_Transmitting = false;
+	uint8_t m_Address = 0;
+	uint8_t m_Buffer[I2C_BUFFER_LENGTH];
+	size_t m_Length = 0;
+	WireDevice* m_Devices[128] = {};
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
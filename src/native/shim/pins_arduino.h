@@ -0,0 +1,44 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+// There are no physical pins on the host, but board definitions still refer to
+// the usual ESP8266 pin names
+static constexpr uint8_t D0 = 16;
+static constexpr uint8_t D1 = 5;
+static constexpr uint8_t D2 = 4;
+static constexpr uint8_t D3 = 0;
+static constexpr uint8_t D4 = 2;
+static constexpr uint8_t D5 = 14;
+static constexpr uint8_t D6 = 12;
+static constexpr uint8_t D7 = 13;
+static constexpr uint8_t D8 = 15;
+static constexpr uint8_t A0 = 17;
+
+static constexpr uint8_t SDA = 4;
+static constexpr uint8_t SCL = 5;
+
+#define LED_BUILTIN 2
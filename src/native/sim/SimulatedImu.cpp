@@ -0,0 +1,375 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SimulatedImu.h"
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SimulatedMux.h"
+#include "debugging/BusMonitor.h"
+#include "debugging/Profiler.h"
+
+namespace SlimeVR::Native::Sim {
+
+float Motion::angle(double t) const {
+	switch (type) {
+		case Type::Rotate:
+			return static_cast<float>(rate * t);
+		case Type::Swing:
+			return amplitude * static_cast<float>(std::sin(2 * PI * frequency * t));
+		case Type::Steps: {
+			const auto steps = std::floor(t * frequency);
+			const auto turned = rate * (t - steps / frequency);
+			return static_cast<float>(
+				steps * amplitude + std::min<double>(turned, amplitude)
+			);
+		}
+		default:
+			return 0;
+	}
+}
+
+float Motion::angularRate(double t) const {
+	switch (type) {
+		case Type::Rotate:
+			return rate;
+		case Type::Swing:
+			return amplitude * 2 * PI * frequency
+				 * static_cast<float>(std::cos(2 * PI * frequency * t));
+		case Type::Steps: {
+			const auto turned = rate * (t - std::floor(t * frequency) / frequency);
+			return turned < amplitude ? rate : 0;
+		}
+		default:
+			return 0;
+	}
+}
+
+double Motion::stepTime(uint32_t index, float angle) const {
+	return index / static_cast<double>(frequency) + angle / static_cast<double>(rate);
+}
+
+uint32_t BusTiming::cost(size_t bytes) const {
+	uint32_t result = transactionMicros;
+	if (clockHz != 0) {
+		// 9 clocks per byte, plus the device and register address bytes
+		result += ((bytes + 2) * 9 * 1000000ull + clockHz - 1) / clockHz;
+	}
+	return result;
+}
+
+double SimulatedImu::StreamClock::nextMicros() const {
+	return startMicros + index * 1e6 / rateHz;
+}
+
+SimulatedImu::SimulatedImu(
+	const char* name,
+	uint8_t address,
+	const SimulationConfig& config
+)
+	: m_Name(name)
+	, m_Address(address)
+	, m_Config(config)
+	, m_StartMicros(micros())
+	, m_Random(config.seed) {
+	m_Config.motion.axis.normalize();
+}
+
+uint8_t SimulatedImu::readReg(uint8_t regAddr) const {
+	uint8_t value;
+	readBytes(regAddr, sizeof(value), &value);
+	return value;
+}
+
+uint16_t SimulatedImu::readReg16(uint8_t regAddr) const {
+	uint8_t buffer[2];
+	readBytes(regAddr, sizeof(buffer), buffer);
+	return buffer[0] | (buffer[1] << 8);
+}
+
+void SimulatedImu::writeReg(uint8_t regAddr, uint8_t value) const {
+	writeBytes(regAddr, sizeof(value), &value);
+}
+
+void SimulatedImu::writeReg16(uint8_t regAddr, uint16_t value) const {
+	uint8_t buffer[2] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8)};
+	writeBytes(regAddr, sizeof(buffer), buffer);
+}
+
+// RegisterInterface is const because the hardware state lives outside of the
+// MCU. Here it doesn't, so the register accesses cast constness away.
+void SimulatedImu::readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const {
+	// I2Cdev splits reads that don't fit the Wire buffer, and every part starts
+	// over at regAddr
+	constexpr size_t WireBufferLength = I2CDEVLIB_WIRE_BUFFER_LENGTH;
+	if (size > WireBufferLength) {
+		for (size_t offset = 0; offset < size; offset += WireBufferLength) {
+			const auto part = std::min<size_t>(size - offset, WireBufferLength);
+			readBytes(regAddr, part, buffer + offset);
+		}
+		return;
+	}
+
+	Debugging::ProfileScope scope{Debugging::ProfileZone::BusRead};
+	Debugging::BusScope bus{m_MonitoredBus, size};
+	auto& imu = self();
+	imu.beginTransaction(size);
+	imu.m_Stats.bytesRead += size;
+
+	for (uint8_t i = 0; i < size; i++) {
+		// Bursts stop auto-incrementing once they reach the FIFO data register,
+		// the rest of the transaction reads the FIFO
+		if (regAddr + i == m_FifoDataReg) {
+			imu.readFifo(size - i, buffer + i);
+			return;
+		}
+		buffer[i] = imu.onRead(regAddr + i);
+	}
+}
+
+void SimulatedImu::writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const {
+	Debugging::BusScope bus{m_MonitoredBus, size};
+	auto& imu = self();
+	imu.beginTransaction(size);
+
+	for (uint8_t i = 0; i < size; i++) {
+		imu.onWrite(isBurstRegister(regAddr) ? regAddr : regAddr + i, buffer[i]);
+	}
+}
+
+std::string SimulatedImu::toString() const {
+	char buf[32];
+	std::snprintf(buf, sizeof(buf), "Sim(%s@0x%02x)", m_Name, m_Address);
+	return std::string(buf);
+}
+
+void SimulatedImu::connectThrough(const SimulatedMux& mux, uint8_t channel) {
+	m_Mux = &mux;
+	m_MuxChannel = channel;
+}
+
+void SimulatedImu::forceOverrun() {
+	catchUp();
+
+	uint8_t streams = 0;
+	for (size_t i = 0; i < m_Clocks.size(); i++) {
+		if (m_Clocks[i].rateHz > 0) {
+			streams |= 1 << i;
+		}
+	}
+	if (streams == 0) {
+		return;
+	}
+
+	auto sample = sampleAt((now() - m_StartMicros) / 1e6);
+	auto overruns = m_Stats.overruns;
+	for (size_t i = 0; i <= m_FifoCapacity && m_Stats.overruns == overruns; i++) {
+		onSample(streams, sample);
+	}
+}
+
+void SimulatedImu::advance(uint32_t durationMicros) {
+	m_SkippedMicros += durationMicros;
+	catchUp();
+}
+
+Quat SimulatedImu::trueOrientation() const {
+	const auto& motion = m_Config.motion;
+	return Quat(motion.axis, motion.angle((now() - m_StartMicros) / 1e6));
+}
+
+uint64_t SimulatedImu::toMicros(double t) const {
+	return m_StartMicros + static_cast<uint64_t>(std::ceil(t * 1e6)) - m_SkippedMicros;
+}
+
+uint64_t SimulatedImu::nextSampleMicros(double t) const {
+	const auto& clock = m_Clocks[__builtin_ctz(Gyro)];
+	const double at = m_StartMicros + t * 1e6;
+	const auto index = std::ceil((at - clock.startMicros) * clock.rateHz / 1e6);
+	const auto sample = clock.startMicros + index * 1e6 / clock.rateHz;
+	return static_cast<uint64_t>(std::ceil(sample)) - m_SkippedMicros;
+}
+
+void SimulatedImu::readFifo(uint8_t size, uint8_t* buffer) {
+	for (uint8_t i = 0; i < size; i++) {
+		if (m_Fifo.empty()) {
+			buffer[i] = m_EmptyFifoByte;
+			continue;
+		}
+
+		buffer[i] = m_Fifo.front();
+		m_Fifo.pop_front();
+		if (++m_FrontOffset == m_FrameSizes.front()) {
+			m_FrameSizes.pop_front();
+			m_FrontOffset = 0;
+		}
+	}
+}
+
+int32_t SimulatedImu::toRaw(float value, float sensitivity, int bits) {
+	const auto limit = static_cast<float>(1 << (bits - 1));
+	const auto raw = std::round(value * sensitivity);
+	return static_cast<int32_t>(std::clamp(raw, -limit, limit - 1));
+}
+
+void SimulatedImu::putInt16(uint8_t* buffer, int16_t value, bool bigEndian) {
+	buffer[bigEndian ? 1 : 0] = static_cast<uint8_t>(value);
+	buffer[bigEndian ? 0 : 1] = static_cast<uint8_t>(value >> 8);
+}
+
+void SimulatedImu::reset() {
+	m_Registers.fill(0);
+	clearFifo();
+	for (auto& clock : m_Clocks) {
+		clock.rateHz = 0;
+	}
+}
+
+void SimulatedImu::setFifoCapacity(size_t bytes) {
+	m_FifoCapacity = m_Config.fifoCapacityBytes != 0 ? m_Config.fifoCapacityBytes
+													 : bytes;
+}
+
+void SimulatedImu::setRate(Stream stream, double rateHz) {
+	auto& clock = m_Clocks[__builtin_ctz(stream)];
+	if (clock.rateHz == rateHz) {
+		return;
+	}
+
+	// All streams tick on a shared time base so that e.g. a 100Hz accel sample
+	// lands on the same instant as every other 200Hz gyro sample
+	clock.rateHz = rateHz;
+	clock.startMicros = m_StartMicros;
+	if (rateHz > 0) {
+		clock.index = static_cast<uint64_t>((now() - m_StartMicros) * rateHz / 1e6)
+					+ 1;
+	}
+}
+
+bool SimulatedImu::pushFrame(const uint8_t* frame, uint8_t size) {
+	m_Stats.framesGenerated++;
+
+	bool overrun = false;
+	while (m_Fifo.size() + size > m_FifoCapacity) {
+		overrun = true;
+		if (m_FifoPolicy == FifoPolicy::StopOnFull || m_FrameSizes.empty()) {
+			m_Stats.framesDropped++;
+			m_Stats.overruns++;
+			onOverrun();
+			return false;
+		}
+
+		size_t drop = m_FrameSizes.front() - m_FrontOffset;
+		if (m_FifoPolicy == FifoPolicy::OverwriteBytes) {
+			drop = std::min(drop, m_Fifo.size() + size - m_FifoCapacity);
+		}
+		m_Fifo.erase(m_Fifo.begin(), m_Fifo.begin() + drop);
+		m_FrontOffset += drop;
+		if (m_FrontOffset == m_FrameSizes.front()) {
+			m_FrameSizes.pop_front();
+			m_FrontOffset = 0;
+			m_Stats.framesDropped++;
+		}
+	}
+
+	m_Fifo.insert(m_Fifo.end(), frame, frame + size);
+	m_FrameSizes.push_back(size);
+
+	if (overrun) {
+		m_Stats.overruns++;
+		onOverrun();
+	}
+	return true;
+}
+
+void SimulatedImu::clearFifo() {
+	m_Fifo.clear();
+	m_FrameSizes.clear();
+	m_FrontOffset = 0;
+}
+
+void SimulatedImu::beginTransaction(size_t bytes) {
+	auto cost = m_Config.bus.cost(bytes);
+	if (cost != 0) {
+		delayMicroseconds(cost);
+	}
+
+	m_Stats.transactions++;
+	m_Stats.busMicros += cost;
+	if (m_Mux != nullptr && !m_Mux->isEnabled(m_MuxChannel)) {
+		m_Stats.misrouted++;
+	}
+
+	catchUp();
+}
+
+uint64_t SimulatedImu::now() const { return micros() + m_SkippedMicros; }
+
+void SimulatedImu::catchUp() {
+	const auto end = static_cast<double>(now());
+
+	while (true) {
+		double next = std::numeric_limits<double>::infinity();
+		for (const auto& clock : m_Clocks) {
+			if (clock.rateHz > 0) {
+				next = std::min(next, clock.nextMicros());
+			}
+		}
+		if (next > end) {
+			return;
+		}
+
+		uint8_t streams = 0;
+		for (size_t i = 0; i < m_Clocks.size(); i++) {
+			auto& clock = m_Clocks[i];
+			if (clock.rateHz > 0 && clock.nextMicros() < next + 1) {
+				streams |= 1 << i;
+				clock.index++;
+			}
+		}
+
+		onSample(streams, sampleAt((next - m_StartMicros) / 1e6));
+	}
+}
+
+SimulatedImu::Sample SimulatedImu::sampleAt(double t) {
+	const auto& motion = m_Config.motion;
+	const Quat orientation(motion.axis, motion.angle(t));
+	const auto gyro = motion.axis * (motion.angularRate(t) * RAD_TO_DEG)
+					+ m_Config.gyroBiasDps;
+	const auto accel = orientation.xform_inv(Vector3(0, 0, 1));
+
+	Sample sample;
+	for (int i = 0; i < 3; i++) {
+		sample.gyro[i] = gyro[i] + m_Normal(m_Random) * m_Config.gyroNoiseDps;
+		sample.accel[i] = accel[i] + m_Normal(m_Random) * m_Config.accelNoiseG;
+	}
+	sample.temperature = m_Config.temperature;
+	return sample;
+}
+
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,234 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <quat.h>
+#include <vector3.h>
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <string>
+
+#include "debugging/BusMonitor.h"
+#include "sensorinterface/RegisterInterface.h"
+
+namespace SlimeVR::Native::Sim {
+
+// Ground truth motion of a simulated IMU. All motions rotate around a fixed
+// axis, so orientation and angular velocity are known exactly at any time.
+struct Motion {
+	enum class Type {
+		Still,
+		// Constant angular velocity of `rate` rad/s
+		Rotate,
+		// Sinusoidal swing of `amplitude` rad at `frequency` Hz
+		Swing,
+		// Turns of `amplitude` rad at `rate` rad/s starting `frequency` times
+		// per second, holding still in between
+		Steps,
+	};
+
+	Type type = Type::Still;
+	Vector3 axis{0, 0, 1};
+	float rate = 0;
+	float amplitude = 0;
+	float frequency = 0;
+
+	[[nodiscard]] float angle(double t) const;
+	[[nodiscard]] float angularRate(double t) const;
+	// Time at which the angle first reaches `angle` rad into step `index`
+	[[nodiscard]] double stepTime(uint32_t index, float angle = 0) const;
+};
+
+struct BusTiming {
+	// Fixed cost of every transaction (start, address, register address)
+	uint32_t transactionMicros = 0;
+	// Bus clock, 0 makes transfers instantaneous
+	uint32_t clockHz = 0;
+
+	[[nodiscard]] uint32_t cost(size_t bytes) const;
+
+	static BusTiming i2c(uint32_t clockHz) { return {0, clockHz}; }
+};
+
+struct SimulationConfig {
+	Motion motion;
+	// Standard deviation of white noise added to each sample
+	float gyroNoiseDps = 0.05f;
+	float accelNoiseG = 0.002f;
+	// Constant offset added to every gyro sample
+	Vector3 gyroBiasDps{0, 0, 0};
+	float temperature = 30.0f;
+	BusTiming bus;
+	// Overrides the chip FIFO size, 0 keeps the datasheet size
+	size_t fifoCapacityBytes = 0;
+	uint32_t seed = 1;
+};
+
+struct SimulationStats {
+	uint32_t transactions = 0;
+	uint32_t bytesRead = 0;
+	uint64_t busMicros = 0;
+	uint32_t framesGenerated = 0;
+	uint32_t framesDropped = 0;
+	uint32_t overruns = 0;
+	// Transactions made while the IMU's mux channel was disabled
+	uint32_t misrouted = 0;
+};
+
+class SimulatedMux;
+
+// Register-level model of an IMU with a FIFO. Chip models decode the ODR and
+// full scale from the registers written by the driver and push FIFO frames as
+// simulated time passes. Time is taken from micros(), so a sensor that isn't
+// polled fast enough overruns its FIFO just like on hardware.
+class SimulatedImu : public Sensors::RegisterInterface {
+public:
+	SimulatedImu(const char* name, uint8_t address, const SimulationConfig& config);
+
+	[[nodiscard]] uint8_t readReg(uint8_t regAddr) const final;
+	[[nodiscard]] uint16_t readReg16(uint8_t regAddr) const final;
+	void writeReg(uint8_t regAddr, uint8_t value) const final;
+	void writeReg16(uint8_t regAddr, uint16_t value) const final;
+	void readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final;
+	void writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final;
+	[[nodiscard]] uint8_t getAddress() const final { return m_Address; }
+	bool hasSensorOnBus() final { return true; }
+	[[nodiscard]] std::string toString() const final;
+
+	// Fills the FIFO until it overflows, as if the host stalled
+	// Puts the IMU behind a channel of `mux`, checking every access selected it
+	void connectThrough(const SimulatedMux& mux, uint8_t channel);
+	// Puts the IMU on an I2C controller other than the first, for BusMonitor
+	void attachTo(uint8_t controller) {
+		m_MonitoredBus = Debugging::i2cBus(controller);
+	}
+	void forceOverrun();
+	// Moves simulated time forward without waiting for it
+	void advance(uint32_t durationMicros);
+
+	// Orientation of the simulated IMU right now
+	[[nodiscard]] Quat trueOrientation() const;
+	// micros() at which the motion reaches simulation time `t`
+	[[nodiscard]] uint64_t toMicros(double t) const;
+	// micros() of the first gyro sample taken at or after simulation time `t`
+	[[nodiscard]] uint64_t nextSampleMicros(double t) const;
+	[[nodiscard]] const SimulationStats& getStats() const { return m_Stats; }
+	[[nodiscard]] const char* getName() const { return m_Name; }
+	[[nodiscard]] uint8_t getFifoDataReg() const { return m_FifoDataReg; }
+
+protected:
+	enum Stream : uint8_t {
+		Gyro = 1 << 0,
+		Accel = 1 << 1,
+		Temp = 1 << 2,
+	};
+
+	enum class FifoPolicy {
+		// Oldest frames are discarded to make room
+		Overwrite,
+		// Only as many bytes as needed are discarded, which leaves a partial
+		// frame at the front
+		OverwriteBytes,
+		// New frames are discarded until the host makes room
+		StopOnFull,
+	};
+
+	// Sensor readings at a sample instant in datasheet units
+	struct Sample {
+		float gyro[3];  // dps
+		float accel[3];  // g
+		float temperature;  // °C
+	};
+
+	virtual void onWrite(uint8_t reg, uint8_t value) { m_Registers[reg] = value; }
+	virtual uint8_t onRead(uint8_t reg) { return m_Registers[reg]; }
+	// Called for every instant at which one or more streams produce data
+	virtual void onSample(uint8_t streams, const Sample& sample) = 0;
+	// Called when pushFrame() runs out of space
+	virtual void onOverrun() {}
+	// Reads FIFO data, by default frames are consumed byte by byte
+	virtual void readFifo(uint8_t size, uint8_t* buffer);
+	// Registers that don't auto-increment on burst writes
+	[[nodiscard]] virtual bool isBurstRegister(uint8_t reg) const {
+		return reg == m_FifoDataReg;
+	}
+
+	// Scales a reading to a signed integer of the given width, saturating
+	[[nodiscard]] static int32_t toRaw(float value, float sensitivity, int bits);
+	static void putInt16(uint8_t* buffer, int16_t value, bool bigEndian = false);
+
+	void reset();
+	// Sets the datasheet FIFO size unless the config overrides it
+	void setFifoCapacity(size_t bytes);
+	void setRate(Stream stream, double rateHz);
+	bool pushFrame(const uint8_t* frame, uint8_t size);
+	void clearFifo();
+	[[nodiscard]] size_t fifoBytes() const { return m_Fifo.size(); }
+	[[nodiscard]] size_t fifoFrames() const { return m_FrameSizes.size(); }
+	[[nodiscard]] size_t fifoCapacity() const { return m_FifoCapacity; }
+	[[nodiscard]] float temperature() const { return m_Config.temperature; }
+
+	std::array<uint8_t, 256> m_Registers{};
+	std::deque<uint8_t> m_Fifo;
+	std::deque<uint8_t> m_FrameSizes;
+	// Bytes of the oldest frame already read by the host
+	uint8_t m_FrontOffset = 0;
+	uint8_t m_FifoDataReg = 0;
+	uint8_t m_EmptyFifoByte = 0;
+	FifoPolicy m_FifoPolicy = FifoPolicy::Overwrite;
+	SimulationStats m_Stats;
+
+private:
+	struct StreamClock {
+		double rateHz = 0;
+		uint64_t startMicros = 0;
+		uint64_t index = 0;
+
+		[[nodiscard]] double nextMicros() const;
+	};
+
+	SimulatedImu& self() const { return const_cast<SimulatedImu&>(*this); }
+	void beginTransaction(size_t bytes);
+	[[nodiscard]] uint64_t now() const;
+	void catchUp();
+	[[nodiscard]] Sample sampleAt(double t);
+
+	const char* m_Name;
+	uint8_t m_Address;
+	const SimulatedMux* m_Mux = nullptr;
+	uint8_t m_MuxChannel = 0;
+	Debugging::Bus m_MonitoredBus = Debugging::Bus::I2C;
+	SimulationConfig m_Config;
+	size_t m_FifoCapacity = 0;
+	uint64_t m_StartMicros;
+	uint64_t m_SkippedMicros = 0;
+	std::array<StreamClock, 3> m_Clocks;
+	std::mt19937 m_Random;
+	std::normal_distribution<float> m_Normal;
+};
+
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,225 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <unordered_map>
+
+#include "SimulatedImu.h"
+
+// Chip models for every SoftFusion driver. Register addresses, ODR and full
+// scale encodings follow the datasheets rather than the drivers, so a driver
+// that configures the chip differently from what it parses shows up as bad
+// data instead of being silently accepted.
+
+namespace SlimeVR::Native::Sim {
+
+class SimulatedICM42688 final : public SimulatedImu {
+public:
+	explicit SimulatedICM42688(const SimulationConfig& config);
+
+protected:
+	void onWrite(uint8_t reg, uint8_t value) final;
+	uint8_t onRead(uint8_t reg) final;
+	void onSample(uint8_t streams, const Sample& sample) final;
+
+private:
+	void powerOn();
+	void updateConfig();
+
+	bool m_HiRes = false;
+	float m_GyroSensitivity = 0;
+	float m_AccelSensitivity = 0;
+};
+
+class SimulatedICM45 : public SimulatedImu {
+public:
+	SimulatedICM45(const char* name, uint8_t whoAmI, const SimulationConfig& config);
+
+protected:
+	void onWrite(uint8_t reg, uint8_t value) final;
+	uint8_t onRead(uint8_t reg) final;
+	void onSample(uint8_t streams, const Sample& sample) final;
+
+private:
+	void updateConfig();
+
+	uint8_t m_WhoAmI;
+	bool m_HiRes = false;
+	float m_GyroSensitivity = 0;
+	float m_AccelSensitivity = 0;
+	// Indirectly addressed registers, keyed by bank << 8 | register
+	std::unordered_map<uint16_t, uint8_t> m_IndirectRegs;
+};
+
+class SimulatedICM45686 final : public SimulatedICM45 {
+public:
+	explicit SimulatedICM45686(const SimulationConfig& config)
+		: SimulatedICM45("ICM45686", 0xe9, config) {}
+};
+
+class SimulatedICM45605 final : public SimulatedICM45 {
+public:
+	explicit SimulatedICM45605(const SimulationConfig& config)
+		: SimulatedICM45("ICM45605", 0xe5, config) {}
+};
+
+// LSM6DSO, LSM6DSR and LSM6DSV share the tagged FIFO, but not all registers
+class SimulatedLSM6DS : public SimulatedImu {
+public:
+	enum class Variant {
+		DSO,
+		DSR,
+		DSV,
+	};
+
+	SimulatedLSM6DS(const char* name, Variant variant, const SimulationConfig& config);
+
+protected:
+	void onWrite(uint8_t reg, uint8_t value) final;
+	uint8_t onRead(uint8_t reg) final;
+	void onSample(uint8_t streams, const Sample& sample) final;
+	void onOverrun() final { m_OverrunLatched = true; }
+
+private:
+	void powerOn();
+	void updateConfig();
+	void pushEntry(uint8_t tag, const int16_t xyz[3]);
+
+	Variant m_Variant;
+	uint8_t m_FifoStatusReg;
+	uint8_t m_TagCounter = 0;
+	bool m_OverrunLatched = false;
+	float m_GyroSensitivity = 0;
+	float m_AccelSensitivity = 0;
+};
+
+class SimulatedLSM6DSO final : public SimulatedLSM6DS {
+public:
+	explicit SimulatedLSM6DSO(const SimulationConfig& config)
+		: SimulatedLSM6DS("LSM6DSO", Variant::DSO, config) {}
+};
+
+class SimulatedLSM6DSR final : public SimulatedLSM6DS {
+public:
+	explicit SimulatedLSM6DSR(const SimulationConfig& config)
+		: SimulatedLSM6DS("LSM6DSR", Variant::DSR, config) {}
+};
+
+class SimulatedLSM6DSV final : public SimulatedLSM6DS {
+public:
+	explicit SimulatedLSM6DSV(const SimulationConfig& config)
+		: SimulatedLSM6DS("LSM6DSV", Variant::DSV, config) {}
+};
+
+class SimulatedLSM6DS3TRC final : public SimulatedImu {
+public:
+	explicit SimulatedLSM6DS3TRC(const SimulationConfig& config);
+
+protected:
+	void onWrite(uint8_t reg, uint8_t value) final;
+	uint8_t onRead(uint8_t reg) final;
+	void onSample(uint8_t streams, const Sample& sample) final;
+	void onOverrun() final { m_Overrun = true; }
+
+private:
+	void powerOn();
+	void updateConfig();
+
+	bool m_Overrun = false;
+	int16_t m_LastAccel[3]{};
+	float m_GyroSensitivity = 0;
+	float m_AccelSensitivity = 0;
+};
+
+// Header mode FIFO shared by BMI160 and BMI270. Partially read frames are kept
+// and sent again on the next read, as the datasheets describe.
+class SimulatedBMI : public SimulatedImu {
+public:
+	SimulatedBMI(const char* name, const SimulationConfig& config);
+
+protected:
+	void readFifo(uint8_t size, uint8_t* buffer) final;
+	void onSample(uint8_t streams, const Sample& sample) final;
+	void onOverrun() final { m_SkippedFrames++; }
+
+	static double odrToHz(uint8_t odr);
+
+	bool m_GyroInFifo = false;
+	bool m_AccelInFifo = false;
+	float m_GyroSensitivity = 0;
+	float m_AccelSensitivity = 0;
+
+private:
+	uint32_t m_SkippedFrames = 0;
+};
+
+class SimulatedBMI160 final : public SimulatedBMI {
+public:
+	explicit SimulatedBMI160(const SimulationConfig& config);
+
+protected:
+	void onWrite(uint8_t reg, uint8_t value) final;
+	uint8_t onRead(uint8_t reg) final;
+
+private:
+	void powerOn();
+	void updateConfig();
+
+	bool m_AccelOn = false;
+	bool m_GyroOn = false;
+};
+
+class SimulatedBMI270 final : public SimulatedBMI {
+public:
+	explicit SimulatedBMI270(const SimulationConfig& config);
+
+protected:
+	void onWrite(uint8_t reg, uint8_t value) final;
+	uint8_t onRead(uint8_t reg) final;
+	[[nodiscard]] bool isBurstRegister(uint8_t reg) const final;
+
+private:
+	void powerOn();
+	void updateConfig();
+};
+
+class SimulatedMPU6050 final : public SimulatedImu {
+public:
+	explicit SimulatedMPU6050(const SimulationConfig& config);
+
+protected:
+	void onWrite(uint8_t reg, uint8_t value) final;
+	uint8_t onRead(uint8_t reg) final;
+	void onSample(uint8_t streams, const Sample& sample) final;
+	void onOverrun() final;
+
+private:
+	void powerOn();
+	void updateConfig();
+
+	float m_GyroSensitivity = 0;
+	float m_AccelSensitivity = 0;
+};
+
+}  // namespace SlimeVR::Native::Sim
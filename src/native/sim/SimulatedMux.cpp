@@ -1,14 +1,17 @@
 /*
 	SlimeVR Code is placed under the MIT license
-	Copyright (c) 2025 Gorbit99 & SlimeVR Contributors
+	Copyright (c) 2025 SlimeVR Contributors
+
 	Permission is hereby granted, free of charge, to any person obtaining a copy
 	of this software and associated documentation files (the "Software"), to deal
 	in the Software without restriction, including without limitation the rights
 	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
 	copies of the Software, and to permit persons to whom the Software is
 	furnished to do so, subject to the following conditions:
+
 	The above copyright notice and this permission notice shall be included in
 	all copies or substantial portions of the Software.
+
 	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
 	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
 	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -18,38 +21,39 @@
 	THE SOFTWARE.
 */
 
-#include "TimeTaken.h"
-
-namespace SlimeVR::Debugging {
+#include "SimulatedMux.h"
 
-TimeTakenMeasurer::TimeTakenMeasurer(const char* name)
-	: name{name} {}
+#include "sensorinterface/I2CPCAInterface.h"
 
-void TimeTakenMeasurer::before() { startMicros = micros(); }
+namespace SlimeVR::Native::Sim {
 
-void TimeTakenMeasurer::after() {
-	uint64_t elapsedMicros = micros() - startMicros;
-	timeTakenMicros += elapsedMicros;
+SimulatedMux::SimulatedMux(uint8_t address, BusTiming bus)
+	: m_Address(address)
+	, m_Bus(bus) {
+	Wire.attach(m_Address, this);
+	// A new mux starts with all channels off, whatever the firmware last selected
+	I2CPCASensorInterface::resetSelection();
+}
 
-	uint64_t sinceLastReportMillis = millis() - lastTimeTakenReportMillis;
+SimulatedMux::~SimulatedMux() { Wire.detach(m_Address); }
 
-	if (sinceLastReportMillis < static_cast<uint64_t>(SecondsBetweenReports * 1e3)) {
+void SimulatedMux::receive(const uint8_t* data, size_t size) {
+	if (size == 0) {
 		return;
 	}
 
-	float usedPercentage = static_cast<float>(timeTakenMicros) / 1e3f
-						 / static_cast<float>(sinceLastReportMillis) * 100;
-
-	m_Logger.info(
-		"%s: %.2f%% of the last period taken (%.2f/%lld millis)",
-		name,
-		usedPercentage,
-		timeTakenMicros / 1e3f,
-		sinceLastReportMillis
-	);
+	// BusTiming counts a register address byte, the mux has none
+	auto cost = m_Bus.cost(size - 1);
+	if (cost != 0) {
+		delayMicroseconds(cost);
+	}
+	m_BusMicros += cost;
 
-	timeTakenMicros = 0;
-	lastTimeTakenReportMillis = millis();
+	m_Selects++;
+	if (data[size - 1] != m_Control) {
+		m_Switches++;
+	}
+	m_Control = data[size - 1];
 }
 
-}  // namespace SlimeVR::Debugging
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,61 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <Wire.h>
+
+#include <cstdint>
+
+#include "SimulatedImu.h"
+
+namespace SlimeVR::Native::Sim {
+
+// I2C mux of the PCA9547/PCA9546A family as I2CPCASensorInterface drives it: one
+// control byte holding a mask of the enabled channels, written before every
+// sensor access. Answers on the host Wire while it exists.
+class SimulatedMux : public WireDevice {
+public:
+	SimulatedMux(uint8_t address, BusTiming bus);
+	~SimulatedMux() override;
+
+	void receive(const uint8_t* data, size_t size) final;
+
+	[[nodiscard]] bool isEnabled(uint8_t channel) const {
+		return (m_Control & (1 << channel)) != 0;
+	}
+	// Control writes that changed the enabled channels, and all of them
+	[[nodiscard]] uint32_t getSwitches() const { return m_Switches; }
+	[[nodiscard]] uint32_t getSelects() const { return m_Selects; }
+	[[nodiscard]] uint64_t getBusMicros() const { return m_BusMicros; }
+
+private:
+	uint8_t m_Address;
+	BusTiming m_Bus;
+	uint8_t m_Control = 0;
+	uint32_t m_Switches = 0;
+	uint32_t m_Selects = 0;
+	uint64_t m_BusMicros = 0;
+};
+
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,56 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "Simulators.h"
+
+namespace SlimeVR::Native::Sim {
+
+SimulationConfig simulationConfig(const Arguments& args) {
+	SimulationConfig config;
+
+	const char* motion = args.get("motion", "swing");
+	if (strcmp(motion, "rotate") == 0) {
+		config.motion.type = Motion::Type::Rotate;
+	} else if (strcmp(motion, "swing") == 0) {
+		config.motion.type = Motion::Type::Swing;
+	} else if (strcmp(motion, "steps") == 0) {
+		config.motion.type = Motion::Type::Steps;
+	}
+	config.motion.axis = Vector3(1, 0.5f, 0.2f).normalized();
+	config.motion.rate = args.get("rate", 90.0f) * DEG_TO_RAD;
+	config.motion.amplitude = args.get("amplitude", 60.0f) * DEG_TO_RAD;
+	config.motion.frequency = args.get("frequency", 0.5f);
+
+	config.gyroNoiseDps = args.get("noise", config.gyroNoiseDps);
+	const float bias = args.get("bias", 0.0f);
+	config.gyroBiasDps = Vector3(bias, -bias, bias);
+
+	config.bus.clockHz = args.get("i2c", 0L);
+	config.bus.transactionMicros = args.get("latency", 0L);
+	config.fifoCapacityBytes = args.get("fifo", 0L);
+	config.seed = args.get("seed", 1L);
+
+	return config;
+}
+
+}  // namespace SlimeVR::Native::Sim
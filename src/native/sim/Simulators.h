@@ -0,0 +1,95 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cctype>
+#include <cstring>
+#include <tuple>
+
+#include "../arguments.h"
+#include "SimulatedImus.h"
+#include "sensors/SensorBuilder.h"
+
+namespace SlimeVR::Native::Sim {
+
+// Pairs a SoftFusion driver with the model of its chip
+template <template <typename RegInterface> typename DriverType, typename SimulatorType>
+struct SimulatedDevice {
+	template <typename RegInterface>
+	using DriverFor = DriverType<RegInterface>;
+	using Driver = DriverType<Sensors::RegisterInterface>;
+	using Simulator = SimulatorType;
+	using Sensor = Sensors::SoftFusionSensor<DriverType, Sensors::SFCALIBRATOR>;
+
+	static constexpr auto Name = Driver::Name;
+};
+
+using SimulatedDevices = std::tuple<
+	SimulatedDevice<Sensors::SoftFusion::Drivers::ICM42688, SimulatedICM42688>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::ICM45686, SimulatedICM45686>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::ICM45605, SimulatedICM45605>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::LSM6DS3TRC, SimulatedLSM6DS3TRC>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::LSM6DSO, SimulatedLSM6DSO>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::LSM6DSR, SimulatedLSM6DSR>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::LSM6DSV, SimulatedLSM6DSV>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::BMI160, SimulatedBMI160>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::BMI270, SimulatedBMI270>,
+	SimulatedDevice<Sensors::SoftFusion::Drivers::MPU6050, SimulatedMPU6050>>;
+
+// Calls `callback(Device{})` for every simulated device whose name matches
+// `filter` ("all" matches everything, case and dashes are ignored)
+template <typename Callback>
+void forEachSimulatedDevice(const char* filter, Callback&& callback) {
+	auto matches = [filter](const char* name) {
+		if (strcmp(filter, "all") == 0) {
+			return true;
+		}
+		const char* f = filter;
+		for (const char* n = name; *n != '\0'; n++) {
+			if (*n == '-') {
+				continue;
+			}
+			if (tolower(*n) != tolower(*f)) {
+				return false;
+			}
+			f++;
+		}
+		return *f == '\0';
+	};
+
+	std::apply(
+		[&](auto... devices) {
+			((matches(decltype(devices)::Name) ? callback(devices) : void()), ...);
+		},
+		SimulatedDevices{}
+	);
+}
+
+// Reads the simulation flags shared by the native tools:
+// --motion=still|rotate|swing|steps, --rate=<dps>, --amplitude=<deg>,
+// --frequency=<Hz>, --noise=<dps>, --bias=<dps>, --i2c=<Hz>,
+// --latency=<us>, --fifo=<bytes>, --seed=<n>
+SimulationConfig simulationConfig(const Arguments& args);
+
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,107 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "TapeRegisterInterface.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace SlimeVR::Native::Sim {
+
+void TapeRegisterInterface::setMode(Mode mode) {
+	if (mode == Mode::Record) {
+		m_Tape.clear();
+		m_ReadSizes.clear();
+		m_FifoBytes = 0;
+	}
+	m_Mode = mode;
+	rewind();
+}
+
+void TapeRegisterInterface::replayReads(std::vector<uint8_t>& scratch) const {
+	size_t cursor = 0;
+	for (auto size : m_ReadSizes) {
+		scratch.resize(std::max(scratch.size(), static_cast<size_t>(size)));
+		memcpy(scratch.data(), &m_Tape[cursor], size);
+		cursor += size;
+	}
+}
+
+uint8_t TapeRegisterInterface::readReg(uint8_t regAddr) const {
+	uint8_t value;
+	readBytes(regAddr, sizeof(value), &value);
+	return value;
+}
+
+uint16_t TapeRegisterInterface::readReg16(uint8_t regAddr) const {
+	uint8_t buffer[2];
+	readBytes(regAddr, sizeof(buffer), buffer);
+	return buffer[0] | (buffer[1] << 8);
+}
+
+void TapeRegisterInterface::writeReg(uint8_t regAddr, uint8_t value) const {
+	writeBytes(regAddr, sizeof(value), &value);
+}
+
+void TapeRegisterInterface::writeReg16(uint8_t regAddr, uint16_t value) const {
+	uint8_t buffer[2] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8)};
+	writeBytes(regAddr, sizeof(buffer), buffer);
+}
+
+void TapeRegisterInterface::readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer)
+	const {
+	switch (m_Mode) {
+		case Mode::PassThrough:
+			m_Imu.readBytes(regAddr, size, buffer);
+			break;
+		case Mode::Record:
+			m_Imu.readBytes(regAddr, size, buffer);
+			m_Tape.insert(m_Tape.end(), buffer, buffer + size);
+			m_ReadSizes.push_back(size);
+			if (const auto fifoReg = m_Imu.getFifoDataReg();
+				regAddr <= fifoReg && fifoReg < regAddr + size) {
+				m_FifoBytes += size - (fifoReg - regAddr);
+			}
+			break;
+		case Mode::Replay: {
+			const auto available = std::min<size_t>(size, m_Tape.size() - m_Cursor);
+			memcpy(buffer, &m_Tape[m_Cursor], available);
+			memset(buffer + available, 0, size - available);
+			m_Cursor += available;
+			break;
+		}
+	}
+}
+
+void TapeRegisterInterface::writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer)
+	const {
+	if (m_Mode != Mode::Replay) {
+		m_Imu.writeBytes(regAddr, size, buffer);
+	}
+}
+
+std::string TapeRegisterInterface::toString() const {
+	return "Tape(" + m_Imu.toString() + ")";
+}
+
+}  // namespace SlimeVR::Native::Sim
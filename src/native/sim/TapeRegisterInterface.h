@@ -0,0 +1,73 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "SimulatedImu.h"
+
+namespace SlimeVR::Native::Sim {
+
+// Records what a driver reads from a simulated IMU and plays it back later,
+// so the driver can be benchmarked without the cost of the model. Replay
+// relies on the driver issuing the same reads for the same data, which holds
+// for all bulkRead implementations.
+class TapeRegisterInterface final : public Sensors::RegisterInterface {
+public:
+	enum class Mode {
+		PassThrough,
+		Record,
+		Replay,
+	};
+
+	explicit TapeRegisterInterface(SimulatedImu& imu)
+		: m_Imu(imu) {}
+
+	void setMode(Mode mode);
+	void rewind() { m_Cursor = 0; }
+	// Performs the recorded reads without a driver, to measure the replay cost
+	void replayReads(std::vector<uint8_t>& scratch) const;
+
+	[[nodiscard]] size_t getRecordedFifoBytes() const { return m_FifoBytes; }
+
+	[[nodiscard]] uint8_t readReg(uint8_t regAddr) const final;
+	[[nodiscard]] uint16_t readReg16(uint8_t regAddr) const final;
+	void writeReg(uint8_t regAddr, uint8_t value) const final;
+	void writeReg16(uint8_t regAddr, uint16_t value) const final;
+	void readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final;
+	void writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final;
+	[[nodiscard]] uint8_t getAddress() const final { return m_Imu.getAddress(); }
+	bool hasSensorOnBus() final { return true; }
+	[[nodiscard]] std::string toString() const final;
+
+private:
+	SimulatedImu& m_Imu;
+	Mode m_Mode = Mode::PassThrough;
+	mutable std::vector<uint8_t> m_Tape;
+	mutable std::vector<uint8_t> m_ReadSizes;
+	mutable size_t m_Cursor = 0;
+	mutable size_t m_FifoBytes = 0;
+};
+
+}  // namespace SlimeVR::Native::Sim
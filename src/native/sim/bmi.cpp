@@ -0,0 +1,300 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SimulatedImus.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SlimeVR::Native::Sim {
+
+namespace {
+
+constexpr uint8_t HeaderDataFrame = 0b10000000;
+constexpr uint8_t HeaderSkipFrame = 0b01000000;
+constexpr uint8_t HeaderGyro = 0b00001000;
+constexpr uint8_t HeaderAccel = 0b00000100;
+// Returned when reading past the end of the FIFO
+constexpr uint8_t OverReadFrame = 0x80;
+
+namespace BMI160Regs {
+constexpr uint8_t ChipId = 0x00;
+constexpr uint8_t ErrReg = 0x02;
+constexpr uint8_t Temperature = 0x20;
+constexpr uint8_t FifoLength = 0x22;
+constexpr uint8_t FifoData = 0x24;
+constexpr uint8_t AccConf = 0x40;
+constexpr uint8_t AccRange = 0x41;
+constexpr uint8_t GyrConf = 0x42;
+constexpr uint8_t GyrRange = 0x43;
+constexpr uint8_t FifoConfig1 = 0x47;
+constexpr uint8_t Cmd = 0x7e;
+}  // namespace BMI160Regs
+
+namespace BMI270Regs {
+constexpr uint8_t ChipId = 0x00;
+constexpr uint8_t InternalStatus = 0x21;
+constexpr uint8_t Temperature = 0x22;
+constexpr uint8_t FifoLength = 0x24;
+constexpr uint8_t FifoData = 0x26;
+constexpr uint8_t GyrGainStatus = 0x38;
+constexpr uint8_t AccConf = 0x40;
+constexpr uint8_t AccRange = 0x41;
+constexpr uint8_t GyrConf = 0x42;
+constexpr uint8_t GyrRange = 0x43;
+constexpr uint8_t FifoConfig0 = 0x48;
+constexpr uint8_t FifoConfig1 = 0x49;
+constexpr uint8_t InitCtrl = 0x59;
+constexpr uint8_t InitData = 0x5e;
+constexpr uint8_t GyrCrtConf = 0x69;
+constexpr uint8_t PwrCtrl = 0x7d;
+constexpr uint8_t Cmd = 0x7e;
+}  // namespace BMI270Regs
+
+constexpr uint8_t CmdSoftReset = 0xb6;
+constexpr uint8_t CmdFifoFlush = 0xb0;
+
+}  // namespace
+
+SimulatedBMI::SimulatedBMI(const char* name, const SimulationConfig& config)
+	: SimulatedImu(name, 0x68, config) {
+	m_EmptyFifoByte = OverReadFrame;
+}
+
+double SimulatedBMI::odrToHz(uint8_t odr) {
+	odr &= 0xf;
+	return odr == 0 ? 0 : 100.0 / std::pow(2.0, 8 - odr);
+}
+
+void SimulatedBMI::readFifo(uint8_t size, uint8_t* buffer) {
+	// Only frames that were read completely leave the FIFO
+	size_t offset = 0;
+	while (!m_FrameSizes.empty() && offset + m_FrameSizes.front() <= size) {
+		const auto frameSize = m_FrameSizes.front();
+		std::copy_n(m_Fifo.begin(), frameSize, buffer + offset);
+		m_Fifo.erase(m_Fifo.begin(), m_Fifo.begin() + frameSize);
+		m_FrameSizes.pop_front();
+		offset += frameSize;
+	}
+
+	const auto partial = std::min(m_Fifo.size(), size - offset);
+	std::copy_n(m_Fifo.begin(), partial, buffer + offset);
+	std::fill(buffer + offset + partial, buffer + size, m_EmptyFifoByte);
+}
+
+void SimulatedBMI::onSample(uint8_t streams, const Sample& sample) {
+	const bool gyro = m_GyroInFifo && (streams & Gyro);
+	const bool accel = m_AccelInFifo && (streams & Accel);
+	if (!gyro && !accel) {
+		return;
+	}
+
+	uint8_t frame[13];
+	uint8_t size = 1;
+	frame[0] = HeaderDataFrame | (gyro ? HeaderGyro : 0) | (accel ? HeaderAccel : 0);
+	if (gyro) {
+		for (int i = 0; i < 3; i++, size += 2) {
+			putInt16(&frame[size], toRaw(sample.gyro[i], m_GyroSensitivity, 16));
+		}
+	}
+	if (accel) {
+		for (int i = 0; i < 3; i++, size += 2) {
+			putInt16(&frame[size], toRaw(sample.accel[i], m_AccelSensitivity, 16));
+		}
+	}
+
+	// A FIFO that stopped on full reports the dropped frames once it has room
+	if (m_SkippedFrames > 0 && fifoBytes() + 2 + size <= fifoCapacity()) {
+		const uint8_t skipFrame[]
+			= {HeaderSkipFrame, static_cast<uint8_t>(std::min(m_SkippedFrames, 255u))};
+		m_SkippedFrames = 0;
+		pushFrame(skipFrame, sizeof(skipFrame));
+	}
+	pushFrame(frame, size);
+}
+
+SimulatedBMI160::SimulatedBMI160(const SimulationConfig& config)
+	: SimulatedBMI("BMI160", config) {
+	m_FifoDataReg = BMI160Regs::FifoData;
+	powerOn();
+}
+
+void SimulatedBMI160::powerOn() {
+	reset();
+	setFifoCapacity(1024);
+	m_Registers[BMI160Regs::AccConf] = 0x28;
+	m_Registers[BMI160Regs::AccRange] = 0x03;
+	m_Registers[BMI160Regs::GyrConf] = 0x28;
+	m_AccelOn = false;
+	m_GyroOn = false;
+	updateConfig();
+}
+
+void SimulatedBMI160::updateConfig() {
+	const auto accRange = m_Registers[BMI160Regs::AccRange] & 0xf;
+	const float accelRangeG = accRange == 0b0101   ? 4
+							: accRange == 0b1000 ? 8
+							: accRange == 0b1100 ? 16
+												 : 2;
+	m_AccelSensitivity = 32768.0f / accelRangeG;
+	const auto gyrRange = m_Registers[BMI160Regs::GyrRange] & 0b111;
+	m_GyroSensitivity = 32768.0f / (2000 >> gyrRange);
+
+	const auto fifoConfig = m_Registers[BMI160Regs::FifoConfig1];
+	m_GyroInFifo = m_GyroOn && (fifoConfig & (1 << 7));
+	m_AccelInFifo = m_AccelOn && (fifoConfig & (1 << 6));
+	setRate(Gyro, m_GyroInFifo ? odrToHz(m_Registers[BMI160Regs::GyrConf]) : 0);
+	setRate(Accel, m_AccelInFifo ? odrToHz(m_Registers[BMI160Regs::AccConf]) : 0);
+}
+
+void SimulatedBMI160::onWrite(uint8_t reg, uint8_t value) {
+	if (reg != BMI160Regs::Cmd) {
+		m_Registers[reg] = value;
+		updateConfig();
+		return;
+	}
+
+	switch (value) {
+		case CmdSoftReset:
+			powerOn();
+			break;
+		case CmdFifoFlush:
+			clearFifo();
+			break;
+		// PMU mode changes, 0b0001xxyy selects the sensor and the mode
+		case 0x10:
+		case 0x11:
+			m_AccelOn = value == 0x11;
+			updateConfig();
+			break;
+		case 0x14:
+		case 0x15:
+			m_GyroOn = value == 0x15;
+			updateConfig();
+			break;
+	}
+}
+
+uint8_t SimulatedBMI160::onRead(uint8_t reg) {
+	switch (reg) {
+		case BMI160Regs::ChipId:
+			return 0xd1;
+		case BMI160Regs::ErrReg:
+			return 0;
+		case BMI160Regs::FifoLength:
+			return fifoBytes();
+		case BMI160Regs::FifoLength + 1:
+			return (fifoBytes() >> 8) & 0b111;
+		case BMI160Regs::Temperature:
+		case BMI160Regs::Temperature + 1: {
+			const auto temp = toRaw(temperature() - 23.0f, 512.0f, 16);
+			return reg == BMI160Regs::Temperature ? temp : temp >> 8;
+		}
+		default:
+			return m_Registers[reg];
+	}
+}
+
+SimulatedBMI270::SimulatedBMI270(const SimulationConfig& config)
+	: SimulatedBMI("BMI270", config) {
+	m_FifoDataReg = BMI270Regs::FifoData;
+	powerOn();
+}
+
+void SimulatedBMI270::powerOn() {
+	reset();
+	setFifoCapacity(6144);
+	m_Registers[BMI270Regs::AccConf] = 0xa8;
+	m_Registers[BMI270Regs::AccRange] = 0x02;
+	m_Registers[BMI270Regs::GyrConf] = 0xa9;
+	m_Registers[BMI270Regs::FifoConfig0] = 0x02;
+	m_Registers[BMI270Regs::FifoConfig1] = 0x10;
+	updateConfig();
+}
+
+void SimulatedBMI270::updateConfig() {
+	const auto accRange = m_Registers[BMI270Regs::AccRange] & 0b11;
+	const auto gyrRange = m_Registers[BMI270Regs::GyrRange] & 0b111;
+	m_AccelSensitivity = 32768.0f / (2 << accRange);
+	m_GyroSensitivity = 32768.0f / (2000 >> gyrRange);
+
+	const auto pwrCtrl = m_Registers[BMI270Regs::PwrCtrl];
+	const auto fifoConfig = m_Registers[BMI270Regs::FifoConfig1];
+	m_GyroInFifo = (pwrCtrl & (1 << 1)) && (fifoConfig & (1 << 7));
+	m_AccelInFifo = (pwrCtrl & (1 << 2)) && (fifoConfig & (1 << 6));
+	m_FifoPolicy = (m_Registers[BMI270Regs::FifoConfig0] & 1) ? FifoPolicy::StopOnFull
+															  : FifoPolicy::Overwrite;
+	setRate(Gyro, m_GyroInFifo ? odrToHz(m_Registers[BMI270Regs::GyrConf]) : 0);
+	setRate(Accel, m_AccelInFifo ? odrToHz(m_Registers[BMI270Regs::AccConf]) : 0);
+}
+
+bool SimulatedBMI270::isBurstRegister(uint8_t reg) const {
+	return reg == BMI270Regs::InitData || SimulatedBMI::isBurstRegister(reg);
+}
+
+void SimulatedBMI270::onWrite(uint8_t reg, uint8_t value) {
+	switch (reg) {
+		case BMI270Regs::InitData:
+			// The config file upload isn't checked
+			return;
+		case BMI270Regs::InitCtrl:
+			m_Registers[reg] = value;
+			m_Registers[BMI270Regs::InternalStatus] = value == 1 ? 0x01 : 0x00;
+			return;
+		case BMI270Regs::Cmd:
+			if (value == CmdSoftReset) {
+				powerOn();
+			} else if (value == CmdFifoFlush) {
+				clearFifo();
+			} else if (value == 0x02) {
+				// Gyro self calibration (CRT) finishes right away with success
+				m_Registers[BMI270Regs::GyrCrtConf] = 0;
+				m_Registers[BMI270Regs::GyrGainStatus] = 0;
+			}
+			return;
+		default:
+			m_Registers[reg] = value;
+			updateConfig();
+			return;
+	}
+}
+
+uint8_t SimulatedBMI270::onRead(uint8_t reg) {
+	switch (reg) {
+		case BMI270Regs::ChipId:
+			return 0x24;
+		case BMI270Regs::FifoLength:
+			return fifoBytes();
+		case BMI270Regs::FifoLength + 1:
+			return (fifoBytes() >> 8) & 0x3f;
+		case BMI270Regs::Temperature:
+		case BMI270Regs::Temperature + 1: {
+			const auto temp = toRaw(temperature() - 23.0f, 512.0f, 16);
+			return reg == BMI270Regs::Temperature ? temp : temp >> 8;
+		}
+		default:
+			return m_Registers[reg];
+	}
+}
+
+}  // namespace SlimeVR::Native::Sim
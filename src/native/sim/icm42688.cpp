@@ -0,0 +1,209 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SimulatedImus.h"
+
+namespace SlimeVR::Native::Sim {
+
+namespace {
+
+namespace Regs {
+constexpr uint8_t DeviceConfig = 0x11;
+constexpr uint8_t FifoConfig = 0x16;
+constexpr uint8_t TempData = 0x1d;
+constexpr uint8_t FifoCount = 0x2e;
+constexpr uint8_t FifoData = 0x30;
+constexpr uint8_t IntfConfig0 = 0x4c;
+constexpr uint8_t PwrMgmt0 = 0x4e;
+constexpr uint8_t GyroConfig0 = 0x4f;
+constexpr uint8_t AccelConfig0 = 0x50;
+constexpr uint8_t FifoConfig1 = 0x5f;
+constexpr uint8_t WhoAmI = 0x75;
+}  // namespace Regs
+
+constexpr size_t FifoSize = 2048;
+constexpr int16_t InvalidSample = -32768;
+
+double odrToHz(uint8_t odr) {
+	constexpr double rates[16] = {
+		0,
+		32000,
+		16000,
+		8000,
+		4000,
+		2000,
+		1000,
+		200,
+		100,
+		50,
+		25,
+		12.5,
+		0,
+		0,
+		0,
+		500,
+	};
+	return rates[odr & 0xf];
+}
+
+}  // namespace
+
+SimulatedICM42688::SimulatedICM42688(const SimulationConfig& config)
+	: SimulatedImu("ICM42688", 0x68, config) {
+	m_FifoDataReg = Regs::FifoData;
+	m_EmptyFifoByte = 0xff;
+	powerOn();
+}
+
+void SimulatedICM42688::powerOn() {
+	reset();
+	setFifoCapacity(FifoSize);
+	m_Registers[Regs::IntfConfig0] = 0x30;  // big endian data and count
+	m_Registers[Regs::GyroConfig0] = 0x06;
+	m_Registers[Regs::AccelConfig0] = 0x06;
+	m_Registers[Regs::FifoConfig1] = 0x00;
+	updateConfig();
+}
+
+void SimulatedICM42688::updateConfig() {
+	const auto gyroConfig = m_Registers[Regs::GyroConfig0];
+	const auto accelConfig = m_Registers[Regs::AccelConfig0];
+	const auto fifoConfig1 = m_Registers[Regs::FifoConfig1];
+	const auto pwrMgmt = m_Registers[Regs::PwrMgmt0];
+
+	m_HiRes = fifoConfig1 & (1 << 4);
+	if (m_HiRes) {
+		// Full scale is fixed to 2000dps and 16g in 20-bit mode
+		m_GyroSensitivity = 131.0f;
+		m_AccelSensitivity = 8192.0f;
+	} else {
+		m_GyroSensitivity = 32768.0f / (2000 >> (gyroConfig >> 5));
+		m_AccelSensitivity = 32768.0f / (16 >> (accelConfig >> 5));
+	}
+
+	const auto fifoMode = m_Registers[Regs::FifoConfig] >> 6;
+	m_FifoPolicy = fifoMode == 0b10 ? FifoPolicy::StopOnFull : FifoPolicy::Overwrite;
+
+	const bool fifoOn = fifoMode != 0;
+	const bool gyroOn = fifoOn && (fifoConfig1 & (1 << 1)) && (pwrMgmt & 0b1100);
+	const bool accelOn = fifoOn && (fifoConfig1 & (1 << 0)) && (pwrMgmt & 0b0011);
+	setRate(Gyro, gyroOn ? odrToHz(gyroConfig) : 0);
+	setRate(Accel, accelOn ? odrToHz(accelConfig) : 0);
+}
+
+void SimulatedICM42688::onWrite(uint8_t reg, uint8_t value) {
+	if (reg == Regs::DeviceConfig && (value & 1)) {
+		powerOn();
+		return;
+	}
+
+	m_Registers[reg] = value;
+
+	switch (reg) {
+		case Regs::FifoConfig:
+			if ((value >> 6) == 0) {
+				clearFifo();
+			}
+			[[fallthrough]];
+		case Regs::PwrMgmt0:
+		case Regs::GyroConfig0:
+		case Regs::AccelConfig0:
+		case Regs::FifoConfig1:
+			updateConfig();
+			break;
+	}
+}
+
+uint8_t SimulatedICM42688::onRead(uint8_t reg) {
+	const auto intfConfig = m_Registers[Regs::IntfConfig0];
+	const bool countBigEndian = intfConfig & (1 << 5);
+	const bool countRecords = intfConfig & (1 << 6);
+	const bool dataBigEndian = intfConfig & (1 << 4);
+
+	switch (reg) {
+		case Regs::WhoAmI:
+			return 0x47;
+		case Regs::FifoCount:
+		case Regs::FifoCount + 1: {
+			const uint16_t count = countRecords ? fifoFrames() : fifoBytes();
+			const bool high = (reg == Regs::FifoCount) == countBigEndian;
+			return high ? count >> 8 : count;
+		}
+		case Regs::TempData:
+		case Regs::TempData + 1: {
+			const auto temp = toRaw(temperature() - 25.0f, 132.48f, 16);
+			const bool high = (reg == Regs::TempData) == dataBigEndian;
+			return high ? temp >> 8 : temp;
+		}
+		default:
+			return m_Registers[reg];
+	}
+}
+
+void SimulatedICM42688::onSample(uint8_t streams, const Sample& sample) {
+	const bool bigEndian = m_Registers[Regs::IntfConfig0] & (1 << 4);
+
+	// Packets always have room for both sensors, a sensor without a new sample
+	// reports -32768
+	uint8_t packet[20]{};
+	packet[0] = (1 << 6) | (1 << 5) | (m_HiRes ? 1 << 4 : 0);
+
+	for (int i = 0; i < 3; i++) {
+		int32_t accel = InvalidSample;
+		int32_t gyro = InvalidSample;
+		if (m_HiRes) {
+			// The upper 16 bits go to the usual place, the rest into the
+			// extension bytes: accel in bits 7:6, gyro in bits 3:1
+			if (streams & Accel) {
+				const auto raw = toRaw(sample.accel[i], m_AccelSensitivity, 18);
+				accel = raw >> 2;
+				packet[17 + i] |= (raw & 0b11) << 6;
+			}
+			if (streams & Gyro) {
+				const auto raw = toRaw(sample.gyro[i], m_GyroSensitivity, 19);
+				gyro = raw >> 3;
+				packet[17 + i] |= (raw & 0b111) << 1;
+			}
+		} else {
+			if (streams & Accel) {
+				accel = toRaw(sample.accel[i], m_AccelSensitivity, 16);
+			}
+			if (streams & Gyro) {
+				gyro = toRaw(sample.gyro[i], m_GyroSensitivity, 16);
+			}
+		}
+		putInt16(&packet[1 + i * 2], accel, bigEndian);
+		putInt16(&packet[7 + i * 2], gyro, bigEndian);
+	}
+
+	const float temp = sample.temperature - 25.0f;
+	if (m_HiRes) {
+		putInt16(&packet[13], toRaw(temp, 132.48f, 16), bigEndian);
+		pushFrame(packet, 20);
+	} else {
+		packet[13] = toRaw(temp, 2.07f, 8);
+		pushFrame(packet, 16);
+	}
+}
+
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,206 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SimulatedImus.h"
+
+#include <cmath>
+
+namespace SlimeVR::Native::Sim {
+
+namespace {
+
+namespace Regs {
+constexpr uint8_t TempData = 0x0c;
+constexpr uint8_t PwrMgmt0 = 0x10;
+constexpr uint8_t FifoCount = 0x12;
+constexpr uint8_t FifoData = 0x14;
+constexpr uint8_t AccelConfig0 = 0x1b;
+constexpr uint8_t GyroConfig0 = 0x1c;
+constexpr uint8_t FifoConfig0 = 0x1d;
+constexpr uint8_t FifoConfig3 = 0x21;
+constexpr uint8_t WhoAmI = 0x72;
+constexpr uint8_t IRegAddrHigh = 0x7c;
+constexpr uint8_t IRegAddrLow = 0x7d;
+constexpr uint8_t IRegData = 0x7e;
+constexpr uint8_t DeviceConfig = 0x7f;
+}  // namespace Regs
+
+// IPREG_TOP1 I2CM_STATUS, reported as done so aux reads never block
+constexpr uint16_t I2CMStatus = 0xa218;
+constexpr uint8_t I2CMStatusDone = 1 << 1;
+
+constexpr int16_t InvalidSample = -32768;
+
+double odrToHz(uint8_t odr) {
+	odr &= 0xf;
+	return odr == 0 ? 0 : 6553.6 / std::pow(2.0, odr - 3);
+}
+
+}  // namespace
+
+SimulatedICM45::SimulatedICM45(
+	const char* name,
+	uint8_t whoAmI,
+	const SimulationConfig& config
+)
+	: SimulatedImu(name, 0x68, config)
+	, m_WhoAmI(whoAmI) {
+	m_FifoDataReg = Regs::FifoData;
+	m_EmptyFifoByte = 0xff;
+	reset();
+	updateConfig();
+}
+
+void SimulatedICM45::updateConfig() {
+	const auto gyroConfig = m_Registers[Regs::GyroConfig0];
+	const auto accelConfig = m_Registers[Regs::AccelConfig0];
+	const auto fifoConfig0 = m_Registers[Regs::FifoConfig0];
+	const auto fifoConfig3 = m_Registers[Regs::FifoConfig3];
+	const auto pwrMgmt = m_Registers[Regs::PwrMgmt0];
+
+	m_HiRes = fifoConfig3 & (1 << 3);
+	if (m_HiRes) {
+		// 20-bit data is always in the widest range
+		m_GyroSensitivity = 524288.0f / 4000;
+		m_AccelSensitivity = 524288.0f / 32;
+	} else {
+		m_GyroSensitivity = 32768.0f / (4000 >> (gyroConfig >> 4));
+		m_AccelSensitivity = 32768.0f / (32 >> ((accelConfig >> 4) & 0b111));
+	}
+
+	// FIFO_MEM_DEPTH 0x1f uses the APEX memory for 8kB, 0x07 is 2kB
+	setFifoCapacity((fifoConfig0 & 0x3f) >= 0x1f ? 8192 : 2048);
+	const auto fifoMode = fifoConfig0 >> 6;
+	m_FifoPolicy = fifoMode == 0b10 ? FifoPolicy::StopOnFull : FifoPolicy::Overwrite;
+
+	const bool fifoOn = fifoMode != 0 && (fifoConfig3 & (1 << 0));
+	const bool gyroOn = fifoOn && (fifoConfig3 & (1 << 2)) && (pwrMgmt & 0b1100);
+	const bool accelOn = fifoOn && (fifoConfig3 & (1 << 1)) && (pwrMgmt & 0b0011);
+	setRate(Gyro, gyroOn ? odrToHz(gyroConfig) : 0);
+	setRate(Accel, accelOn ? odrToHz(accelConfig) : 0);
+}
+
+void SimulatedICM45::onWrite(uint8_t reg, uint8_t value) {
+	if (reg == Regs::DeviceConfig && (value & (1 << 1))) {
+		reset();
+		m_IndirectRegs.clear();
+		updateConfig();
+		return;
+	}
+
+	if (reg == Regs::IRegData) {
+		const uint16_t address
+			= m_Registers[Regs::IRegAddrHigh] << 8 | m_Registers[Regs::IRegAddrLow];
+		m_IndirectRegs[address] = value;
+		m_Registers[Regs::IRegAddrLow]++;
+		return;
+	}
+
+	m_Registers[reg] = value;
+
+	switch (reg) {
+		case Regs::FifoConfig0:
+			if ((value >> 6) == 0) {
+				clearFifo();
+			}
+			[[fallthrough]];
+		case Regs::PwrMgmt0:
+		case Regs::GyroConfig0:
+		case Regs::AccelConfig0:
+		case Regs::FifoConfig3:
+			updateConfig();
+			break;
+	}
+}
+
+uint8_t SimulatedICM45::onRead(uint8_t reg) {
+	switch (reg) {
+		case Regs::WhoAmI:
+			return m_WhoAmI;
+		case Regs::FifoCount:
+			return fifoFrames();
+		case Regs::FifoCount + 1:
+			return fifoFrames() >> 8;
+		case Regs::TempData:
+		case Regs::TempData + 1: {
+			const auto temp = toRaw(temperature() - 25.0f, 128.0f, 16);
+			return reg == Regs::TempData ? temp : temp >> 8;
+		}
+		case Regs::IRegData: {
+			const uint16_t address
+				= m_Registers[Regs::IRegAddrHigh] << 8 | m_Registers[Regs::IRegAddrLow];
+			m_Registers[Regs::IRegAddrLow]++;
+			if (address == I2CMStatus) {
+				return I2CMStatusDone;
+			}
+			auto it = m_IndirectRegs.find(address);
+			return it != m_IndirectRegs.end() ? it->second : 0;
+		}
+		default:
+			return m_Registers[reg];
+	}
+}
+
+void SimulatedICM45::onSample(uint8_t streams, const Sample& sample) {
+	// Same layout as the ICM42688, but 20-bit data keeps 4 extra bits for both
+	// sensors: accel in the upper nibble, gyro in the lower one
+	uint8_t packet[20]{};
+	packet[0] = (1 << 6) | (1 << 5) | (m_HiRes ? 1 << 4 : 0);
+
+	for (int i = 0; i < 3; i++) {
+		int32_t accel = InvalidSample;
+		int32_t gyro = InvalidSample;
+		if (m_HiRes) {
+			if (streams & Accel) {
+				const auto raw = toRaw(sample.accel[i], m_AccelSensitivity, 20);
+				accel = raw >> 4;
+				packet[17 + i] |= (raw & 0xf) << 4;
+			}
+			if (streams & Gyro) {
+				const auto raw = toRaw(sample.gyro[i], m_GyroSensitivity, 20);
+				gyro = raw >> 4;
+				packet[17 + i] |= raw & 0xf;
+			}
+		} else {
+			if (streams & Accel) {
+				accel = toRaw(sample.accel[i], m_AccelSensitivity, 16);
+			}
+			if (streams & Gyro) {
+				gyro = toRaw(sample.gyro[i], m_GyroSensitivity, 16);
+			}
+		}
+		putInt16(&packet[1 + i * 2], accel);
+		putInt16(&packet[7 + i * 2], gyro);
+	}
+
+	const float temp = sample.temperature - 25.0f;
+	if (m_HiRes) {
+		putInt16(&packet[13], toRaw(temp, 128.0f, 16));
+		pushFrame(packet, 20);
+	} else {
+		packet[13] = toRaw(temp, 2.0f, 8);
+		pushFrame(packet, 16);
+	}
+}
+
+}  // namespace SlimeVR::Native::Sim
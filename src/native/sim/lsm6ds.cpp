@@ -0,0 +1,227 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SimulatedImus.h"
+
+#include <cmath>
+
+namespace SlimeVR::Native::Sim {
+
+namespace {
+
+namespace Regs {
+constexpr uint8_t FifoCtrl3 = 0x09;
+constexpr uint8_t FifoCtrl4 = 0x0a;
+constexpr uint8_t WhoAmI = 0x0f;
+constexpr uint8_t Ctrl1 = 0x10;
+constexpr uint8_t Ctrl2 = 0x11;
+constexpr uint8_t Ctrl3 = 0x12;
+// LSM6DSV only, the others keep the full scale in CTRL1/CTRL2
+constexpr uint8_t Ctrl6 = 0x15;
+constexpr uint8_t Ctrl8 = 0x17;
+constexpr uint8_t FifoData = 0x78;
+}  // namespace Regs
+
+constexpr uint8_t GyroTag = 0x01;
+constexpr uint8_t AccelTag = 0x02;
+constexpr uint8_t TempTag = 0x03;
+
+constexpr size_t FifoEntrySize = 7;
+// The datasheets give 3kB for the LSM6DSO/DSR and 4.5kB for the LSM6DSV, but
+// the 10-bit sample counter caps what can actually be reported
+constexpr size_t MaxFifoEntries = 0x3ff;
+
+// 12.5, 26, 52, 104, 208, 416... Hz
+double lsm6dsoRate(uint8_t code) {
+	if (code == 0 || code > 10) {
+		return 0;
+	}
+	return code == 1 ? 12.5 : 13.0 * (1 << (code - 1));
+}
+
+// 1.875, 7.5, 15, 30, 60, 120, 240... Hz
+double lsm6dsvRate(uint8_t code) {
+	if (code == 0 || code > 12) {
+		return 0;
+	}
+	return code == 1 ? 1.875 : 7.5 * std::pow(2.0, code - 2);
+}
+
+}  // namespace
+
+SimulatedLSM6DS::SimulatedLSM6DS(
+	const char* name,
+	Variant variant,
+	const SimulationConfig& config
+)
+	: SimulatedImu(name, 0x6a, config)
+	, m_Variant(variant)
+	, m_FifoStatusReg(variant == Variant::DSV ? 0x1b : 0x3a) {
+	m_FifoDataReg = Regs::FifoData;
+	powerOn();
+}
+
+void SimulatedLSM6DS::powerOn() {
+	reset();
+	setFifoCapacity(MaxFifoEntries * FifoEntrySize);
+	m_Registers[Regs::Ctrl3] = 1 << 2;  // IF_INC
+	m_OverrunLatched = false;
+	updateConfig();
+}
+
+void SimulatedLSM6DS::updateConfig() {
+	const auto ctrl1 = m_Registers[Regs::Ctrl1];
+	const auto ctrl2 = m_Registers[Regs::Ctrl2];
+	const auto fifoCtrl3 = m_Registers[Regs::FifoCtrl3];
+	const auto fifoCtrl4 = m_Registers[Regs::FifoCtrl4];
+
+	bool gyroOn;
+	bool accelOn;
+	double tempRate;
+	if (m_Variant == Variant::DSV) {
+		gyroOn = ctrl2 & 0xf;
+		accelOn = ctrl1 & 0xf;
+		m_GyroSensitivity = 1000 / (4.375f * (1 << (m_Registers[Regs::Ctrl6] & 0xf)));
+		m_AccelSensitivity = 1000 / (0.061f * (1 << (m_Registers[Regs::Ctrl8] & 0b11)));
+		constexpr double tempRates[] = {0, 1.875, 15, 60};
+		tempRate = tempRates[(fifoCtrl4 >> 4) & 0b11];
+	} else {
+		gyroOn = ctrl2 >> 4;
+		accelOn = ctrl1 >> 4;
+		if (ctrl2 & (1 << 1)) {
+			m_GyroSensitivity = 1000 / 4.375f;
+		} else if (m_Variant == Variant::DSR && (ctrl2 & 1)) {
+			m_GyroSensitivity = 1000 / 140.0f;
+		} else {
+			m_GyroSensitivity = 1000 / (8.75f * (1 << ((ctrl2 >> 2) & 0b11)));
+		}
+		// FS_XL is ordered 2g, 16g, 4g, 8g
+		constexpr float accelScales[] = {0.061f, 0.488f, 0.122f, 0.244f};
+		m_AccelSensitivity = 1000 / accelScales[(ctrl1 >> 2) & 0b11];
+		constexpr double tempRates[] = {0, 1.6, 12.5, 52};
+		tempRate = tempRates[(fifoCtrl4 >> 4) & 0b11];
+	}
+
+	const auto rate = m_Variant == Variant::DSV ? lsm6dsvRate : lsm6dsoRate;
+	const bool fifoOn = (fifoCtrl4 & 0b111) != 0;
+	setRate(Gyro, fifoOn && gyroOn ? rate(fifoCtrl3 >> 4) : 0);
+	setRate(Accel, fifoOn && accelOn ? rate(fifoCtrl3 & 0xf) : 0);
+	setRate(Temp, fifoOn ? tempRate : 0);
+}
+
+void SimulatedLSM6DS::onWrite(uint8_t reg, uint8_t value) {
+	if (reg == Regs::Ctrl3 && (value & 1)) {
+		powerOn();
+		return;
+	}
+
+	m_Registers[reg] = value;
+
+	switch (reg) {
+		case Regs::FifoCtrl4:
+			if ((value & 0b111) == 0) {
+				// Bypass mode empties the FIFO
+				clearFifo();
+				m_OverrunLatched = false;
+			}
+			[[fallthrough]];
+		case Regs::FifoCtrl3:
+		case Regs::Ctrl1:
+		case Regs::Ctrl2:
+		case Regs::Ctrl6:
+		case Regs::Ctrl8:
+			updateConfig();
+			break;
+	}
+}
+
+uint8_t SimulatedLSM6DS::onRead(uint8_t reg) {
+	if (reg == Regs::WhoAmI) {
+		switch (m_Variant) {
+			case Variant::DSO:
+				return 0x6c;
+			case Variant::DSR:
+				return 0x6b;
+			case Variant::DSV:
+				return 0x70;
+		}
+	}
+
+	if (reg == m_FifoStatusReg) {
+		return fifoFrames();
+	}
+
+	if (reg == m_FifoStatusReg + 1) {
+		// FIFO_OVR_LATCHED clears on read
+		uint8_t status = (fifoFrames() >> 8) & 0b11;
+		if (m_OverrunLatched) {
+			status |= 1 << 3;
+			m_OverrunLatched = false;
+		}
+		if (fifoBytes() + FifoEntrySize > fifoCapacity()) {
+			status |= 1 << 5;  // FIFO_FULL_IA
+		}
+		return status;
+	}
+
+	return m_Registers[reg];
+}
+
+void SimulatedLSM6DS::pushEntry(uint8_t tag, const int16_t xyz[3]) {
+	uint8_t entry[FifoEntrySize];
+	entry[0] = (tag << 3) | (m_TagCounter << 1);
+	for (int i = 0; i < 3; i++) {
+		putInt16(&entry[1 + i * 2], xyz[i]);
+	}
+	pushFrame(entry, sizeof(entry));
+}
+
+void SimulatedLSM6DS::onSample(uint8_t streams, const Sample& sample) {
+	m_TagCounter = (m_TagCounter + 1) & 0b11;
+
+	if (streams & Gyro) {
+		int16_t xyz[3];
+		for (int i = 0; i < 3; i++) {
+			xyz[i] = toRaw(sample.gyro[i], m_GyroSensitivity, 16);
+		}
+		pushEntry(GyroTag, xyz);
+	}
+
+	if (streams & Accel) {
+		int16_t xyz[3];
+		for (int i = 0; i < 3; i++) {
+			xyz[i] = toRaw(sample.accel[i], m_AccelSensitivity, 16);
+		}
+		pushEntry(AccelTag, xyz);
+	}
+
+	if (streams & Temp) {
+		const int16_t xyz[3]
+			= {static_cast<int16_t>(toRaw(sample.temperature - 25.0f, 256.0f, 16)),
+			   0,
+			   0};
+		pushEntry(TempTag, xyz);
+	}
+}
+
+}  // namespace SlimeVR::Native::Sim
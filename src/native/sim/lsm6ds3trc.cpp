@@ -0,0 +1,168 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SimulatedImus.h"
+
+#include <algorithm>
+
+namespace SlimeVR::Native::Sim {
+
+namespace {
+
+namespace Regs {
+constexpr uint8_t FifoCtrl3 = 0x08;
+constexpr uint8_t FifoCtrl5 = 0x0a;
+constexpr uint8_t WhoAmI = 0x0f;
+constexpr uint8_t Ctrl1XL = 0x10;
+constexpr uint8_t Ctrl2G = 0x11;
+constexpr uint8_t Ctrl3C = 0x12;
+constexpr uint8_t OutTemp = 0x20;
+constexpr uint8_t FifoStatus1 = 0x3a;
+constexpr uint8_t FifoStatus2 = 0x3b;
+constexpr uint8_t FifoData = 0x3e;
+}  // namespace Regs
+
+constexpr size_t FifoSize = 4096;
+constexpr size_t DataSetSize = 12;
+
+// 12.5, 26, 52, 104, 208, 416... Hz
+double odrToHz(uint8_t code) {
+	if (code == 0 || code > 10) {
+		return 0;
+	}
+	return code == 1 ? 12.5 : 13.0 * (1 << (code - 1));
+}
+
+}  // namespace
+
+SimulatedLSM6DS3TRC::SimulatedLSM6DS3TRC(const SimulationConfig& config)
+	: SimulatedImu("LSM6DS3TRC", 0x6a, config) {
+	m_FifoDataReg = Regs::FifoData;
+	powerOn();
+}
+
+void SimulatedLSM6DS3TRC::powerOn() {
+	reset();
+	setFifoCapacity(FifoSize);
+	m_Registers[Regs::Ctrl3C] = 1 << 2;  // IF_INC
+	m_Overrun = false;
+	updateConfig();
+}
+
+void SimulatedLSM6DS3TRC::updateConfig() {
+	const auto ctrl1 = m_Registers[Regs::Ctrl1XL];
+	const auto ctrl2 = m_Registers[Regs::Ctrl2G];
+	const auto fifoCtrl3 = m_Registers[Regs::FifoCtrl3];
+	const auto fifoCtrl5 = m_Registers[Regs::FifoCtrl5];
+
+	if (ctrl2 & (1 << 1)) {
+		m_GyroSensitivity = 1000 / 4.375f;
+	} else {
+		m_GyroSensitivity = 1000 / (8.75f * (1 << ((ctrl2 >> 2) & 0b11)));
+	}
+	// FS_XL is ordered 2g, 16g, 4g, 8g
+	constexpr float accelScales[] = {0.061f, 0.488f, 0.122f, 0.244f};
+	m_AccelSensitivity = 1000 / accelScales[(ctrl1 >> 2) & 0b11];
+
+	// Data sets of gyro and accel are stored for every gyro sample, never
+	// faster than the FIFO ODR. Accel repeats its last sample in between.
+	const bool fifoOn = (fifoCtrl5 & 0b111) != 0;
+	const bool gyroInFifo = fifoOn && ((fifoCtrl3 >> 3) & 0b111) != 0;
+	const bool accelInFifo = fifoOn && (fifoCtrl3 & 0b111) != 0;
+	const auto fifoRate = odrToHz(fifoCtrl5 >> 3);
+	setRate(Gyro, gyroInFifo ? std::min(odrToHz(ctrl2 >> 4), fifoRate) : 0);
+	setRate(Accel, accelInFifo ? odrToHz(ctrl1 >> 4) : 0);
+}
+
+void SimulatedLSM6DS3TRC::onWrite(uint8_t reg, uint8_t value) {
+	if (reg == Regs::Ctrl3C && (value & 1)) {
+		powerOn();
+		return;
+	}
+
+	m_Registers[reg] = value;
+
+	switch (reg) {
+		case Regs::FifoCtrl5:
+			if ((value & 0b111) == 0) {
+				// Bypass mode empties the FIFO and clears the overrun
+				clearFifo();
+				m_Overrun = false;
+			}
+			[[fallthrough]];
+		case Regs::FifoCtrl3:
+		case Regs::Ctrl1XL:
+		case Regs::Ctrl2G:
+			updateConfig();
+			break;
+	}
+}
+
+uint8_t SimulatedLSM6DS3TRC::onRead(uint8_t reg) {
+	const auto words = fifoBytes() / 2;
+
+	switch (reg) {
+		case Regs::WhoAmI:
+			return 0x6a;
+		case Regs::OutTemp:
+		case Regs::OutTemp + 1: {
+			const auto temp = toRaw(temperature() - 25.0f, 256.0f, 16);
+			return reg == Regs::OutTemp ? temp : temp >> 8;
+		}
+		case Regs::FifoStatus1:
+			return words;
+		case Regs::FifoStatus2: {
+			uint8_t status = (words >> 8) & 0b111;
+			if (m_Overrun) {
+				status |= 1 << 6;
+			}
+			if (fifoBytes() == 0) {
+				status |= 1 << 4;
+			}
+			return status;
+		}
+		default:
+			return m_Registers[reg];
+	}
+}
+
+void SimulatedLSM6DS3TRC::onSample(uint8_t streams, const Sample& sample) {
+	if (streams & Accel) {
+		for (int i = 0; i < 3; i++) {
+			m_LastAccel[i] = toRaw(sample.accel[i], m_AccelSensitivity, 16);
+		}
+	}
+
+	if (!(streams & Gyro)) {
+		return;
+	}
+
+	uint8_t dataSet[DataSetSize];
+	for (int i = 0; i < 3; i++) {
+		putInt16(&dataSet[i * 2], toRaw(sample.gyro[i], m_GyroSensitivity, 16));
+		putInt16(&dataSet[6 + i * 2], m_LastAccel[i]);
+	}
+	pushFrame(dataSet, sizeof(dataSet));
+}
+
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,169 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SimulatedImus.h"
+
+namespace SlimeVR::Native::Sim {
+
+namespace {
+
+namespace Regs {
+constexpr uint8_t SmplrtDiv = 0x19;
+constexpr uint8_t Config = 0x1a;
+constexpr uint8_t GyroConfig = 0x1b;
+constexpr uint8_t AccelConfig = 0x1c;
+constexpr uint8_t FifoEn = 0x23;
+constexpr uint8_t IntStatus = 0x3a;
+constexpr uint8_t TempOut = 0x41;
+constexpr uint8_t UserCtrl = 0x6a;
+constexpr uint8_t PwrMgmt1 = 0x6b;
+constexpr uint8_t FifoCount = 0x72;
+constexpr uint8_t FifoData = 0x74;
+constexpr uint8_t WhoAmI = 0x75;
+}  // namespace Regs
+
+constexpr uint8_t FifoEnTemp = 1 << 7;
+constexpr uint8_t FifoEnGyroX = 1 << 6;
+constexpr uint8_t FifoEnGyroY = 1 << 5;
+constexpr uint8_t FifoEnGyroZ = 1 << 4;
+constexpr uint8_t FifoEnAccel = 1 << 3;
+constexpr uint8_t UserCtrlFifoEnable = 1 << 6;
+constexpr uint8_t UserCtrlFifoReset = 1 << 2;
+constexpr uint8_t PwrMgmt1Reset = 1 << 7;
+constexpr uint8_t PwrMgmt1Sleep = 1 << 6;
+constexpr uint8_t IntStatusFifoOverflow = 1 << 4;
+
+constexpr size_t FifoSize = 1024;
+
+}  // namespace
+
+SimulatedMPU6050::SimulatedMPU6050(const SimulationConfig& config)
+	: SimulatedImu("MPU6050", 0x68, config) {
+	m_FifoDataReg = Regs::FifoData;
+	// Overflowing loses sync with the sample boundaries, which is why the
+	// driver resets the FIFO on overflow
+	m_FifoPolicy = FifoPolicy::OverwriteBytes;
+	powerOn();
+}
+
+void SimulatedMPU6050::powerOn() {
+	reset();
+	setFifoCapacity(FifoSize);
+	m_Registers[Regs::PwrMgmt1] = PwrMgmt1Sleep;
+	updateConfig();
+}
+
+void SimulatedMPU6050::updateConfig() {
+	const auto gyroRange = (m_Registers[Regs::GyroConfig] >> 3) & 0b11;
+	const auto accelRange = (m_Registers[Regs::AccelConfig] >> 3) & 0b11;
+	m_GyroSensitivity = 32768.0f / (250 << gyroRange);
+	m_AccelSensitivity = 32768.0f / (2 << accelRange);
+
+	// The gyro output rate is 8kHz without the DLPF and 1kHz with it, every
+	// enabled FIFO source is written at the sample rate
+	const auto dlpf = m_Registers[Regs::Config] & 0b111;
+	const double gyroRate = dlpf == 0 || dlpf == 7 ? 8000 : 1000;
+	const double sampleRate = gyroRate / (1 + m_Registers[Regs::SmplrtDiv]);
+
+	const bool on = !(m_Registers[Regs::PwrMgmt1] & PwrMgmt1Sleep)
+				 && (m_Registers[Regs::UserCtrl] & UserCtrlFifoEnable)
+				 && m_Registers[Regs::FifoEn] != 0;
+	setRate(Gyro, on ? sampleRate : 0);
+}
+
+void SimulatedMPU6050::onWrite(uint8_t reg, uint8_t value) {
+	switch (reg) {
+		case Regs::PwrMgmt1:
+			if (value & PwrMgmt1Reset) {
+				powerOn();
+				return;
+			}
+			break;
+		case Regs::UserCtrl:
+			if (value & UserCtrlFifoReset) {
+				clearFifo();
+				value &= ~UserCtrlFifoReset;
+			}
+			break;
+	}
+
+	m_Registers[reg] = value;
+	updateConfig();
+}
+
+uint8_t SimulatedMPU6050::onRead(uint8_t reg) {
+	switch (reg) {
+		case Regs::WhoAmI:
+			return 0x68;
+		case Regs::IntStatus: {
+			// Cleared on read
+			const auto status = m_Registers[reg];
+			m_Registers[reg] = 0;
+			return status;
+		}
+		case Regs::FifoCount:
+			return fifoBytes() >> 8;
+		case Regs::FifoCount + 1:
+			return fifoBytes();
+		case Regs::TempOut:
+		case Regs::TempOut + 1: {
+			const auto temp = toRaw(temperature() - 36.53f, 340.0f, 16);
+			return reg == Regs::TempOut ? temp >> 8 : temp;
+		}
+		default:
+			return m_Registers[reg];
+	}
+}
+
+void SimulatedMPU6050::onOverrun() {
+	m_Registers[Regs::IntStatus] |= IntStatusFifoOverflow;
+}
+
+void SimulatedMPU6050::onSample(uint8_t streams, const Sample& sample) {
+	const auto fifoEn = m_Registers[Regs::FifoEn];
+
+	// Big endian, in register order: accel, temperature, gyro
+	uint8_t frame[14];
+	uint8_t size = 0;
+	if (fifoEn & FifoEnAccel) {
+		for (int i = 0; i < 3; i++, size += 2) {
+			const auto raw = toRaw(sample.accel[i], m_AccelSensitivity, 16);
+			putInt16(&frame[size], raw, true);
+		}
+	}
+	if (fifoEn & FifoEnTemp) {
+		putInt16(&frame[size], toRaw(sample.temperature - 36.53f, 340.0f, 16), true);
+		size += 2;
+	}
+	constexpr uint8_t gyroBits[] = {FifoEnGyroX, FifoEnGyroY, FifoEnGyroZ};
+	for (int i = 0; i < 3; i++) {
+		if (fifoEn & gyroBits[i]) {
+			const auto raw = toRaw(sample.gyro[i], m_GyroSensitivity, 16);
+			putInt16(&frame[size], raw, true);
+			size += 2;
+		}
+	}
+	pushFrame(frame, size);
+}
+
+}  // namespace SlimeVR::Native::Sim
@@ -0,0 +1,192 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// `sim` tool: runs SoftFusion sensors against simulated IMUs and reports how
+// the whole sensor loop keeps up with the FIFO.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "arguments.h"
+#include "sensorinterface/RecordingRegisterInterface.h"
+#include "sim/Simulators.h"
+#include "tools.h"
+
+namespace SlimeVR::Native {
+
+namespace {
+
+struct SimulationRun {
+	Sim::SimulationConfig config;
+	uint32_t seconds;
+	uint32_t count;
+	// Time spent in the rest of the firmware loop per iteration
+	uint32_t workMicros;
+	uint32_t overrunIntervalMillis;
+	// Records sensor 0 like DEBUG_RECORD_IMU does, 0 disables
+	size_t recordBytes;
+};
+
+// Angle between where the sensor and the simulation think down is
+float tiltError(const Quat& fused, const Quat& truth) {
+	const Vector3 up(0, 0, 1);
+	const auto dot = fused.xform_inv(up).dot(truth.xform_inv(up));
+	return std::acos(std::clamp(dot, -1.0f, 1.0f)) * RAD_TO_DEG;
+}
+
+template <typename Device>
+void simulate(const SimulationRun& run) {
+	std::vector<std::unique_ptr<typename Device::Simulator>> imus;
+	std::unique_ptr<Sensors::RecordingRegisterInterface> recorder;
+	std::vector<std::unique_ptr<typename Device::Sensor>> sensors;
+	for (uint32_t i = 0; i < run.count; i++) {
+		auto config = run.config;
+		config.seed += i;
+		imus.push_back(std::make_unique<typename Device::Simulator>(config));
+
+		Sensors::RegisterInterface* registers = imus.back().get();
+		if (i == 0 && run.recordBytes != 0) {
+			recorder = std::make_unique<Sensors::RecordingRegisterInterface>(
+				*registers,
+				i,
+				run.recordBytes
+			);
+			registers = recorder.get();
+		}
+		sensors.push_back(std::make_unique<typename Device::Sensor>(i, *registers, 0.0f)
+		);
+	}
+
+	for (auto& sensor : sensors) {
+		sensor->motionSetup();
+		if (!sensor->isWorking()) {
+			printf("%-12s failed to initialize\n", Device::Name);
+			return;
+		}
+	}
+	if (recorder) {
+		recorder->start(Device::Sensor::TypeID);
+	}
+
+	const auto start = micros();
+	auto lastOverrun = start;
+	uint64_t sensorMicros = 0;
+	uint32_t loops = 0;
+	while (micros() - start < run.seconds * 1000000ull) {
+		const auto before = micros();
+		for (auto& sensor : sensors) {
+			sensor->motionLoop();
+		}
+		sensorMicros += micros() - before;
+		loops++;
+
+		delayMicroseconds(run.workMicros);
+
+		if (run.overrunIntervalMillis != 0
+			&& micros() - lastOverrun >= run.overrunIntervalMillis * 1000ull) {
+			lastOverrun = micros();
+			for (auto& imu : imus) {
+				imu->forceOverrun();
+			}
+		}
+	}
+
+	Sim::SimulationStats total;
+	float maxTiltError = 0;
+	for (size_t i = 0; i < imus.size(); i++) {
+		const auto& stats = imus[i]->getStats();
+		total.transactions += stats.transactions;
+		total.bytesRead += stats.bytesRead;
+		total.busMicros += stats.busMicros;
+		total.framesGenerated += stats.framesGenerated;
+		total.framesDropped += stats.framesDropped;
+		total.overruns += stats.overruns;
+		maxTiltError = std::max(
+			maxTiltError,
+			tiltError(sensors[i]->getFusedRotation(), imus[i]->trueOrientation())
+		);
+	}
+
+	printf(
+		"%-12s %3u %9.0f %8.1f %8u %8u %8u %7.1f%% %7.2f\n",
+		Device::Name,
+		run.count,
+		loops / static_cast<float>(run.seconds),
+		sensorMicros / static_cast<float>(loops),
+		total.framesGenerated,
+		total.framesDropped,
+		total.overruns,
+		total.busMicros / (run.seconds * 1e6f) * 100,
+		maxTiltError
+	);
+
+	if (recorder) {
+		const auto& rotation = sensors[0]->getFusedRotation();
+		printf(
+			"Recorded sensor 0, final rotation: w=%.6f x=%.6f y=%.6f z=%.6f\n",
+			rotation.w,
+			rotation.x,
+			rotation.y,
+			rotation.z
+		);
+	}
+}
+
+}  // namespace
+
+int runSimulation(int argc, char** argv) {
+	Arguments args(argc, argv);
+
+	SimulationRun run{
+		.config = Sim::simulationConfig(args),
+		.seconds = static_cast<uint32_t>(strtoul(args.positional(1, "5"), nullptr, 10)),
+		.count = static_cast<uint32_t>(args.get("count", 1L)),
+		.workMicros = static_cast<uint32_t>(args.get("work", 0L)),
+		.overrunIntervalMillis = static_cast<uint32_t>(args.get("overrun", 0L)),
+		.recordBytes = static_cast<size_t>(args.get("record", 0L)) * 1024,
+	};
+
+	configuration.setup();
+
+	printf(
+		"%-12s %3s %9s %8s %8s %8s %8s %8s %7s\n",
+		"imu",
+		"n",
+		"loops/s",
+		"us/loop",
+		"frames",
+		"dropped",
+		"overrun",
+		"bus",
+		"tilt°"
+	);
+	Sim::forEachSimulatedDevice(args.positional(0, "all"), [&](auto device) {
+		simulate<decltype(device)>(run);
+	});
+	return 0;
+}
+
+}  // namespace SlimeVR::Native
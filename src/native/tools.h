@@ -0,0 +1,57 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+namespace SlimeVR::Native {
+
+struct Tool {
+	const char* name;
+	const char* usage;
+	int (*run)(int argc, char** argv);
+};
+
+// Runs the regular firmware setup()/loop() on the host
+int runFirmware(int argc, char** argv);
+// Runs SoftFusion sensors against simulated IMUs
+int runSimulation(int argc, char** argv);
+// Measures the FIFO parsing cost of the SoftFusion drivers
+int runFifoBenchmark(int argc, char** argv);
+// Measures the cost and accuracy of the VQF filters
+int runVqfBenchmark(int argc, char** argv);
+// Replays an IMU recording made with DEBUG_RECORD_IMU
+int runReplay(int argc, char** argv);
+// Measures the latency from a motion to the packet received by a server
+int runLatencyBenchmark(int argc, char** argv);
+// Stands in for the SlimeVR server and reports what trackers send to it
+int runMockServer(int argc, char** argv);
+// Measures the network throughput of SensorManager and Connection
+int runNetworkBenchmark(int argc, char** argv);
+// Measures how long sensors take to calibrate, faster than real time
+int runCalibrationBenchmark(int argc, char** argv);
+// Measures how long the tracker takes to reconnect, faster than real time
+int runReconnectBenchmark(int argc, char** argv);
+// Measures how the sensor loop scales with the number of sensors
+int runScalingBenchmark(int argc, char** argv);
+
+}  // namespace SlimeVR::Native
@@ -0,0 +1,60 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+// Host stand-ins for the ESP WiFi handling. The native build is always
+// "connected": the shim routes UDP over the host's network stack.
+
+#include "GlobalVars.h"
+#include "network/wifihandler.h"
+#include "network/wifiprovisioning.h"
+
+namespace SlimeVR {
+
+bool WiFiNetwork::isConnected() const { return true; }
+
+void WiFiNetwork::setUp() {
+	wifiHandlerLogger.info("Native build, using the host network");
+	wifiState = WiFiReconnectionStatus::Success;
+	isWifiConnected = true;
+	hadWifi = true;
+}
+
+void WiFiNetwork::upkeep() {}
+
+void WiFiNetwork::setWiFiCredentials(const char* SSID, const char* pass) {}
+
+IPAddress WiFiNetwork::getAddress() { return WiFi.localIP(); }
+
+WiFiNetwork::WiFiReconnectionStatus WiFiNetwork::getWiFiState() { return wifiState; }
+
+void WifiProvisioning::upkeepProvisioning() {}
+
+void WifiProvisioning::startProvisioning() {}
+
+void WifiProvisioning::stopProvisioning() {}
+
+void WifiProvisioning::provideNeighbours() {}
+
+bool WifiProvisioning::isProvisioning() const { return false; }
+
+}  // namespace SlimeVR
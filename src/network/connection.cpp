@@ -26,10 +26,13 @@
 #include <string_view>
 
 #include "GlobalVars.h"
+#include "debugging/Metrics.h"
+#include "debugging/Profiler.h"
 #include "logging/Logger.h"
 #include "packets.h"
 
 #define TIMEOUT 3000UL
+#define TELEMETRY_INTERVAL 5000UL
 
 template <typename T>
 uint8_t* convert_to_chars(T src, uint8_t* target) {
@@ -78,12 +81,14 @@ bool Connection::endPacket() {
 		return true;
 	}
 
+	Debugging::ProfileScope scope{Debugging::ProfileZone::UdpSend};
 	int r = m_UDP.endPacket();
 	if (r == 0) {
 		// This is usually just `ERR_ABRT` but the UDP client doesn't expose
 		// the full error code to us, so we just have to live with it.
 
 		// m_Logger.warn("UDP endPacket() failed");
+		Debugging::metrics.increment(Debugging::Counter::UdpSendFailures);
 	}
 
 	return r > 0;
@@ -113,6 +118,7 @@ bool Connection::endBundle() {
 size_t Connection::write(const uint8_t* buffer, size_t size) {
 	if (m_IsBundle) {
 		if (m_BundlePacketPosition + size > sizeof(m_Packet)) {
+			Debugging::metrics.increment(Debugging::Counter::BundleOverflows);
 			return 0;
 		}
 		memcpy(m_Packet + m_BundlePacketPosition, buffer, size);
@@ -193,6 +199,13 @@ bool Connection::sendLongString(const char* str) {
 	return sendBytes((const uint8_t*)str, size);
 }
 
+bool Connection::sendHistogram(const Debugging::LogHistogram& histogram) {
+	MUST_TRANSFER_BOOL(sendInt(histogram.count()));
+	MUST_TRANSFER_BOOL(sendInt(histogram.percentile(0.5f)));
+	MUST_TRANSFER_BOOL(sendInt(histogram.percentile(0.99f)));
+	return sendInt(histogram.max());
+}
+
 int Connection::getWriteError() { return m_UDP.getWriteError(); }
 
 // PACKET_HEARTBEAT 0
@@ -407,6 +420,48 @@ void Connection::sendFlexData(uint8_t sensorId, float flexLevel) {
 	));
 }
 
+#if ENABLE_TELEMETRY
+// PACKET_TELEMETRY 106
+void Connection::sendTelemetry() {
+	using Debugging::metrics;
+
+	MUST(m_Connected);
+	MUST(sendPacketCallback(SendPacketType::Telemetry, [&]() {
+		MUST_TRANSFER_BOOL(sendByte(Debugging::Metrics::CounterCount));
+		for (size_t i = 0; i < Debugging::Metrics::CounterCount; i++) {
+			const auto counter = static_cast<Debugging::Counter>(i);
+			MUST_TRANSFER_BOOL(sendInt(metrics.get(counter)));
+		}
+		MUST_TRANSFER_BOOL(sendByte(Debugging::Metrics::GaugeCount));
+		for (size_t i = 0; i < Debugging::Metrics::GaugeCount; i++) {
+			const auto gauge = static_cast<Debugging::Gauge>(i);
+			MUST_TRANSFER_BOOL(sendFloat(metrics.get(gauge)));
+		}
+		MUST_TRANSFER_BOOL(sendByte(Debugging::Metrics::HistogramCount));
+		for (size_t i = 0; i < Debugging::Metrics::HistogramCount; i++) {
+			const auto histogram = static_cast<Debugging::Histogram>(i);
+			MUST_TRANSFER_BOOL(sendHistogram(metrics.get(histogram)));
+		}
+		auto& sensors = sensorManager.getSensors();
+		MUST_TRANSFER_BOOL(sendByte(sensors.size()));
+		for (auto& sensor : sensors) {
+			MUST_TRANSFER_BOOL(sendByte(sensor->getSensorId()));
+			MUST_TRANSFER_BOOL(sendFloat(sensor->m_tpsCounter.getAveragedTPS()));
+			MUST_TRANSFER_BOOL(sendHistogram(sensor->m_sendLatency));
+		}
+		return true;
+	}));
+
+	// Histograms cover one telemetry interval each
+	for (size_t i = 0; i < Debugging::Metrics::HistogramCount; i++) {
+		metrics.get(static_cast<Debugging::Histogram>(i)).reset();
+	}
+	for (auto& sensor : sensorManager.getSensors()) {
+		sensor->m_sendLatency.reset();
+	}
+}
+#endif
+
 #if ENABLE_INSPECTION
 void Connection::sendInspectionRawIMUData(
 	uint8_t sensorId,
@@ -529,6 +584,21 @@ void Connection::maybeRequestFeatureFlags() {
 	m_FeatureFlagsRequestAttempts++;
 }
 
+#if ENABLE_TELEMETRY
+void Connection::maybeSendTelemetry() {
+	if (!m_ServerFeatures.has(ServerFeatures::PROTOCOL_TELEMETRY_SUPPORT)) {
+		return;
+	}
+
+	if (millis() - m_LastTelemetryTimestamp < TELEMETRY_INTERVAL) {
+		return;
+	}
+
+	sendTelemetry();
+	m_LastTelemetryTimestamp = millis();
+}
+#endif
+
 bool Connection::isSensorStateUpdated(int i, std::unique_ptr<Sensor>& sensor) {
 	return (m_AckedSensorState[i] != sensor->getSensorState()
 			|| m_AckedSensorCalibration[i] != sensor->hasCompletedRestCalibration()
@@ -636,6 +706,9 @@ void Connection::update() {
 
 	updateSensorState(sensors);
 	maybeRequestFeatureFlags();
+#if ENABLE_TELEMETRY
+	maybeSendTelemetry();
+#endif
 
 	if (m_LastPacketTimestamp + TIMEOUT < millis()) {
 		statusManager.setStatus(SlimeVR::Status::SERVER_CONNECTING, true);
@@ -652,6 +725,7 @@ void Connection::update() {
 			false
 		);
 		m_Logger.warn("Connection to server timed out");
+		Debugging::metrics.increment(Debugging::Counter::ServerTimeouts);
 
 		// Reset server address to broadcast if disconnected
 		m_ServerHost = IPAddress(255, 255, 255, 255);
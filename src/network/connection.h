@@ -29,6 +29,7 @@
 #include <optional>
 
 #include "../configuration/SensorConfig.h"
+#include "debugging/LogHistogram.h"
 #include "featureflags.h"
 #include "globals.h"
 #include "packets.h"
@@ -98,6 +99,11 @@ public:
 	// PACKET_FLEX_DATA 26
 	void sendFlexData(uint8_t sensorId, float flexLevel);
 
+#if ENABLE_TELEMETRY
+	// PACKET_TELEMETRY 106
+	void sendTelemetry();
+#endif
+
 #if ENABLE_INSPECTION
 	void sendInspectionRawIMUData(
 		uint8_t sensorId,
@@ -139,6 +145,9 @@ public:
 private:
 	void updateSensorState(std::vector<std::unique_ptr<::Sensor>>& sensors);
 	void maybeRequestFeatureFlags();
+#if ENABLE_TELEMETRY
+	void maybeSendTelemetry();
+#endif
 	bool isSensorStateUpdated(int i, std::unique_ptr<::Sensor>& sensor);
 
 	bool beginPacket();
@@ -157,6 +166,8 @@ private:
 	bool sendBytes(const uint8_t* c, size_t length);
 	bool sendShortString(const char* str);
 	bool sendLongString(const char* str);
+	// Count, p50, p99 and max, in microseconds
+	bool sendHistogram(const Debugging::LogHistogram& histogram);
 
 	template <typename Packet>
 	bool sendPacket(
@@ -235,6 +246,10 @@ private:
 	unsigned long m_FeatureFlagsRequestTimestamp = millis();
 	ServerFeatures m_ServerFeatures{};
 
+#if ENABLE_TELEMETRY
+	unsigned long m_LastTelemetryTimestamp = 0;
+#endif
+
 	bool m_IsBundle = false;
 	uint16_t m_BundlePacketPosition = 0;
 	uint16_t m_BundlePacketInnerCount = 0;
@@ -27,6 +27,8 @@
 #include <algorithm>
 #include <cstring>
 
+#include "../debug.h"
+
 /**
  * Bit packed flags, enum values start with 0 and indicate which bit it is.
  *
@@ -38,6 +40,12 @@ public:
 		// Server can parse bundle packets: `PACKET_BUNDLE` = 100 (0x64).
 		PROTOCOL_BUNDLE_SUPPORT,
 
+#if ENABLE_TELEMETRY
+		// Server can parse telemetry packets: `PACKET_TELEMETRY` = 106 (0x6A). Not
+		// assigned by the server yet, see ENABLE_TELEMETRY
+		PROTOCOL_TELEMETRY_SUPPORT,
+#endif
+
 		// Add new flags here
 
 		BITS_TOTAL,
@@ -23,13 +23,17 @@
 #include "manager.h"
 
 #include "GlobalVars.h"
+#include "debugging/Profiler.h"
 
 namespace SlimeVR::Network {
 
 void Manager::setup() { wifiNetwork.setUp(); }
 
 void Manager::update() {
-	wifiNetwork.upkeep();
+	{
+		Debugging::ProfileScope scope{Debugging::ProfileZone::WiFiUpkeep};
+		wifiNetwork.upkeep();
+	}
 
 	auto wasConnected = m_IsConnected;
 
@@ -27,6 +27,7 @@
 #include <cstdint>
 
 #include "../consts.h"
+#include "../debug.h"
 #include "../sensors/sensor.h"
 
 enum class SendPacketType : uint8_t {
@@ -57,6 +58,10 @@ enum class SendPacketType : uint8_t {
 	// PositionData = 27,
 	Bundle = 100,
 	Inspection = 105,
+#if ENABLE_TELEMETRY
+	// Not assigned by the server yet, see ENABLE_TELEMETRY
+	Telemetry = 106,
+#endif
 };
 
 enum class ReceivePacketType : uint8_t {
@@ -23,6 +23,7 @@
 #include "network/wifihandler.h"
 
 #include "GlobalVars.h"
+#include "debugging/Metrics.h"
 #include "globals.h"
 #if !ESP8266
 #include "esp_wifi.h"
@@ -156,6 +157,10 @@ void WiFiNetwork::upkeep() {
 			lastRssiSample = millis();
 			uint8_t signalStrength = WiFi.RSSI();
 			networkConnection.sendSignalStrength(signalStrength);
+			Debugging::metrics.set(
+				Debugging::Gauge::SignalStrength,
+				static_cast<int8_t>(signalStrength)
+			);
 		}
 		return;
 	}
@@ -163,6 +168,7 @@ void WiFiNetwork::upkeep() {
 	if (isConnected()) {
 		statusManager.setStatus(SlimeVR::Status::WIFI_CONNECTING, true);
 		wifiHandlerLogger.warn("Connection to WiFi lost, reconnecting...");
+		Debugging::metrics.increment(Debugging::Counter::WiFiReconnects);
 		trySavedCredentials();
 		return;
 	}
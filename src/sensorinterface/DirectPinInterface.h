@@ -38,6 +38,7 @@ public:
 	int digitalRead() override final;
 	void pinMode(uint8_t mode) override final;
 	void digitalWrite(uint8_t val) override final;
+	[[nodiscard]] bool isDirect() const final { return true; }
 
 	[[nodiscard]] std::string toString() const final {
 		using namespace std::string_literals;
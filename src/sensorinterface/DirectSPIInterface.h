@@ -46,6 +46,10 @@ public:
 		return m_spiClass.transfer(args...);
 	}
 
+	void writeBytes(const uint8_t* data, uint32_t size) {
+		m_spiClass.writeBytes(data, size);
+	}
+
 	const SPISettings& getSpiSettings();
 
 private:
@@ -0,0 +1,90 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "I2CClock.h"
+
+#include "debugging/Metrics.h"
+
+namespace SlimeVR {
+
+I2CClock i2cClock;
+
+namespace {
+
+// Fast-mode Plus, with a stop halfway for wiring that can't quite make it
+const uint32_t ClockSteps[] = {700000, 1000000};
+
+}  // namespace
+
+void I2CClock::negotiate(uint8_t bus, const Probe& probe) {
+	uint32_t clockHz = getI2CClock(bus);
+	for (uint32_t step : ClockSteps) {
+		if (step <= clockHz || step > I2C_FAST_SPEED) {
+			continue;
+		}
+
+		setI2CClock(bus, step);
+		const uint32_t failures = m_Buses[bus].failures;
+		if (!probe(step) || m_Buses[bus].failures != failures) {
+			setI2CClock(bus, clockHz);
+			break;
+		}
+		clockHz = step;
+	}
+
+	m_Buses[bus] = {};
+	if (clockHz != I2C_SPEED) {
+		m_Logger.info(
+			"I2C bus %u runs at %lu kHz",
+			bus,
+			static_cast<unsigned long>(clockHz / 1000)
+		);
+	}
+}
+
+void I2CClock::update() {
+	for (uint8_t bus = 0; bus < I2CBusCount; bus++) {
+		auto& stats = m_Buses[bus];
+		if (stats.reads < WindowReads) {
+			continue;
+		}
+
+		const uint32_t clockHz = getI2CClock(bus);
+		if (stats.failures > MaxWindowFailures && clockHz > I2C_SPEED) {
+			m_Logger.warn(
+				"%lu of %lu reads failed on I2C bus %u at %lu kHz, going back to %lu "
+				"kHz",
+				static_cast<unsigned long>(stats.failures),
+				static_cast<unsigned long>(stats.reads),
+				bus,
+				static_cast<unsigned long>(clockHz / 1000),
+				static_cast<unsigned long>(I2C_SPEED / 1000)
+			);
+			setI2CClock(bus, I2C_SPEED);
+			Debugging::metrics.increment(Debugging::Counter::I2CClockFallbacks);
+		}
+		stats = {};
+	}
+}
+
+}  // namespace SlimeVR
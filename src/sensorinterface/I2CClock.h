@@ -0,0 +1,72 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "I2CWireSensorInterface.h"
+#include "logging/Logger.h"
+
+namespace SlimeVR {
+
+/*
+ * Runs the I2C controllers faster than I2C_SPEED where the wiring allows it.
+ * negotiate() raises the clock of a controller step by step, up to
+ * I2C_FAST_SPEED, for as long as its sensors read back correctly. If reads start
+ * failing later on, update() drops the clock back to I2C_SPEED for good.
+ */
+class I2CClock {
+public:
+	// Checks every sensor on the controller at the clock it just got
+	using Probe = std::function<bool(uint32_t clockHz)>;
+
+	void negotiate(uint8_t bus, const Probe& probe);
+	// Called by I2CImpl for every read
+	void recordRead(uint8_t bus, bool failed) {
+		auto& stats = m_Buses[bus];
+		stats.reads++;
+		stats.failures += failed;
+	}
+	// Must not run while a read is in flight
+	void update();
+
+private:
+	// Reads per window, and failed ones that make a raised clock fall back
+	static constexpr uint32_t WindowReads = 1000;
+	static constexpr uint32_t MaxWindowFailures = 5;
+
+	struct BusStats {
+		uint32_t reads = 0;
+		uint32_t failures = 0;
+	};
+
+	BusStats m_Buses[I2CBusCount];
+
+	Logging::Logger m_Logger = Logging::Logger("I2CClock");
+};
+
+extern I2CClock i2cClock;
+
+}  // namespace SlimeVR
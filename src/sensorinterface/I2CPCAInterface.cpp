@@ -22,19 +22,74 @@
 */
 #include "I2CPCAInterface.h"
 
+#include <optional>
+
+#include "debugging/BusMonitor.h"
+
+namespace {
+
+struct MuxSelection {
+	uint8_t sclPin;
+	uint8_t sdaPin;
+	uint8_t address;
+	uint8_t channel;
+
+	bool operator==(const MuxSelection&) const = default;
+};
+
+// Last channel written to a mux on each controller, so that sensors sharing it
+// skip the select. Only trusted while the controller's epoch hasn't moved, as a
+// failed transaction or a reinit may have left the mux somewhere else.
+std::optional<MuxSelection> activeSelections[SlimeVR::I2CBusCount];
+uint32_t selectionEpochs[SlimeVR::I2CBusCount];
+
+}  // namespace
+
 bool SlimeVR::I2CPCASensorInterface::init() {
 	m_Wire.init();
 	return true;
 }
 
+void SlimeVR::I2CPCASensorInterface::resetSelection() {
+	for (auto& selection : activeSelections) {
+		selection.reset();
+	}
+}
+
 void SlimeVR::I2CPCASensorInterface::swapIn() {
 	m_Wire.swapIn();
-	Wire.beginTransmission(m_Address);
-	Wire.write(1 << m_Channel);
-	Wire.endTransmission();
+
+	const uint8_t bus = m_Wire.getController();
+	auto& activeSelection = activeSelections[bus];
+	const MuxSelection selection{
+		m_Wire.getSclPin(),
+		m_Wire.getSdaPin(),
+		m_Address,
+		m_Channel,
+	};
+	if (activeSelection == selection && selectionEpochs[bus] == getI2CEpoch(bus)) {
+		return;
+	}
+
+	uint8_t result;
+	{
+		SlimeVR::Debugging::BusScope scope{SlimeVR::Debugging::i2cBus(bus), 1};
+		auto& wire = i2cWire(bus);
+		wire.beginTransmission(m_Address);
+		wire.write(1 << m_Channel);
+		result = wire.endTransmission();
+	}
 #ifdef ESP32
 	// On ESP32 we need to reconnect to I2C bus for some reason
 	m_Wire.disconnect();
 	m_Wire.swapIn();
 #endif
+	// Retried on the next visit if the mux didn't acknowledge. Recorded after the
+	// reconnect above, which the mux doesn't see
+	if (result == 0) {
+		activeSelection = selection;
+		selectionEpochs[bus] = getI2CEpoch(bus);
+	} else {
+		activeSelection.reset();
+	}
 }
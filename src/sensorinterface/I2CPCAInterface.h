@@ -36,16 +36,31 @@ public:
 		uint8_t sclpin,
 		uint8_t sdapin,
 		uint8_t address,
-		uint8_t channel
+		uint8_t channel,
+		uint8_t bus = 0
 	)
-		: m_Wire(sclpin, sdapin)
+		: m_Wire(sclpin, sdapin, bus)
 		, m_Address(address)
 		, m_Channel(channel){};
 	~I2CPCASensorInterface(){};
 
 	bool init() override final;
+	// Only writes the channel when the mux isn't already switched to it
 	void swapIn() override final;
 
+	[[nodiscard]] uint32_t getBusKey() const final {
+		return m_Wire.getBusKey() | m_Address << 8 | m_Channel;
+	}
+	[[nodiscard]] uint8_t getController() const final {
+		return m_Wire.getController();
+	}
+	[[nodiscard]] bool isI2C() const final { return true; }
+	// The PCA9547 and PCA9546A top out at Fast-mode
+	[[nodiscard]] uint32_t getMaxI2CClock() const final { return 400000; }
+
+	// Forgets the selected channel, for when the mux may have been reset
+	static void resetSelection();
+
 	[[nodiscard]] std::string toString() const final {
 		using namespace std::string_literals;
 		return "PCAWire("s + std::to_string(m_Channel) + ")";
@@ -25,51 +25,100 @@
 
 #include <optional>
 
+#include "debugging/BusMonitor.h"
+
 #ifdef ESP32
 #include "driver/i2c.h"
 #endif
 
-std::optional<uint8_t> activeSCLPin;
-std::optional<uint8_t> activeSDAPin;
-bool isI2CActive = false;
+namespace {
+
+// Pins each controller is routed to
+struct I2CBusState {
+	std::optional<uint8_t> sclPin;
+	std::optional<uint8_t> sdaPin;
+	bool active = false;
+	uint32_t clockHz = I2C_SPEED;
+	uint32_t epoch = 0;
+};
+
+I2CBusState busStates[SlimeVR::I2CBusCount];
+
+}  // namespace
 
 namespace SlimeVR {
-void swapI2C(uint8_t sclPin, uint8_t sdaPin) {
-	if (sclPin != activeSCLPin || sdaPin != activeSDAPin || !isI2CActive) {
-		Wire.flush();
+TwoWire& i2cWire(uint8_t bus) {
+#if defined(SLIMEVR_NATIVE) || (defined(ESP32) && SOC_I2C_NUM > 1)
+	if (bus == 1) {
+		return Wire1;
+	}
+#endif
+	return Wire;
+}
+
+void swapI2C(uint8_t bus, uint8_t sclPin, uint8_t sdaPin) {
+	auto& state = busStates[bus];
+	auto& wire = i2cWire(bus);
+	if (sclPin != state.sclPin || sdaPin != state.sdaPin || !state.active) {
+		wire.flush();
 #ifdef ESP32
-		if (!isI2CActive) {
+		if (!state.active) {
 			// Reset HWI2C to avoid being affected by I2CBUS reset
-			Wire.end();
+			wire.end();
 		}
 
-		if (activeSCLPin && activeSCLPin) {
+		if (state.sclPin && state.sdaPin) {
 			// Disconnect pins from HWI2C
-			gpio_set_direction((gpio_num_t)*activeSCLPin, GPIO_MODE_INPUT);
-			gpio_set_direction((gpio_num_t)*activeSDAPin, GPIO_MODE_INPUT);
+			gpio_set_direction((gpio_num_t)*state.sclPin, GPIO_MODE_INPUT);
+			gpio_set_direction((gpio_num_t)*state.sdaPin, GPIO_MODE_INPUT);
 		}
 
-		if (isI2CActive) {
-			i2c_set_pin(I2C_NUM_0, sdaPin, sclPin, false, false, I2C_MODE_MASTER);
+		if (state.active) {
+			i2c_set_pin(
+				static_cast<i2c_port_t>(bus),
+				sdaPin,
+				sclPin,
+				false,
+				false,
+				I2C_MODE_MASTER
+			);
 		} else {
-			Wire.begin(static_cast<int>(sdaPin), static_cast<int>(sclPin), I2C_SPEED);
-			Wire.setTimeOut(150);
+			wire.begin(
+				static_cast<int>(sdaPin),
+				static_cast<int>(sclPin),
+				state.clockHz
+			);
+			wire.setTimeOut(150);
 		}
 #else
-		Wire.begin(static_cast<int>(sdaPin), static_cast<int>(sclPin));
+		wire.begin(static_cast<int>(sdaPin), static_cast<int>(sclPin));
 #endif
 
-		activeSCLPin = sclPin;
-		activeSDAPin = sdaPin;
-		isI2CActive = true;
+		state.sclPin = sclPin;
+		state.sdaPin = sdaPin;
+		state.active = true;
+		state.epoch++;
 	}
 }
 
-void disconnectI2C() {
-	Wire.flush();
-	isI2CActive = false;
+void setI2CClock(uint8_t bus, uint32_t clockHz) {
+	busStates[bus].clockHz = clockHz;
+	i2cWire(bus).setClock(clockHz);
+	Debugging::busMonitor.setClock(Debugging::i2cBus(bus), clockHz);
+}
+
+uint32_t getI2CClock(uint8_t bus) { return busStates[bus].clockHz; }
+
+uint32_t getI2CEpoch(uint8_t bus) { return busStates[bus].epoch; }
+
+void invalidateI2C(uint8_t bus) { busStates[bus].epoch++; }
+
+void disconnectI2C(uint8_t bus) {
+	i2cWire(bus).flush();
+	busStates[bus].active = false;
+	busStates[bus].epoch++;
 #ifdef ESP32
-	Wire.end();
+	i2cWire(bus).end();
 #endif
 }
 }  // namespace SlimeVR
@@ -25,39 +25,69 @@
 #define SENSORINTERFACE_I2CWIRE_H
 
 #include <Arduino.h>
+#include <Wire.h>
 #include <i2cscan.h>
 
 #include "SensorInterface.h"
 #include "globals.h"
 
 namespace SlimeVR {
-void swapI2C(uint8_t sclPin, uint8_t sdaPin);
-void disconnectI2C();
+
+// Hardware I2C controllers sensors can be spread over, Wire and Wire1
+#if defined(SLIMEVR_NATIVE) || (defined(ESP32) && SOC_I2C_NUM > 1)
+constexpr uint8_t I2CBusCount = 2;
+#else
+constexpr uint8_t I2CBusCount = 1;
+#endif
+
+TwoWire& i2cWire(uint8_t bus);
+void swapI2C(uint8_t bus, uint8_t sclPin, uint8_t sdaPin);
+void disconnectI2C(uint8_t bus);
+// Kept across swapI2C() and disconnectI2C(), I2C_SPEED until set
+void setI2CClock(uint8_t bus, uint32_t clockHz);
+uint32_t getI2CClock(uint8_t bus);
+// Bumped when the controller is reinitialised or a transaction on it fails, for
+// caches of what the devices on it were last set to
+uint32_t getI2CEpoch(uint8_t bus);
+void invalidateI2C(uint8_t bus);
 
 /**
  * I2C Sensor interface using direct arduino Wire on provided pins
  *
+ * The bus is the I2C controller to use. Chips with a single one run every bus on
+ * it, swapping the pins like they do for buses on different pins.
  */
 class I2CWireSensorInterface : public SensorInterface {
 public:
-	I2CWireSensorInterface(uint8_t sclpin, uint8_t sdapin)
+	I2CWireSensorInterface(uint8_t sclpin, uint8_t sdapin, uint8_t bus = 0)
 		: _sdaPin(sdapin)
-		, _sclPin(sclpin){};
+		, _sclPin(sclpin)
+		, _bus(bus < I2CBusCount ? bus : 0){};
 	~I2CWireSensorInterface(){};
 
 	bool init() override final { return true; }
-	void swapIn() override final { swapI2C(_sclPin, _sdaPin); }
-	void disconnect() { disconnectI2C(); }
+	void swapIn() override final { swapI2C(_bus, _sclPin, _sdaPin); }
+	void disconnect() { disconnectI2C(_bus); }
+
+	[[nodiscard]] uint32_t getBusKey() const override {
+		return static_cast<uint32_t>(_sclPin) << 24
+			 | static_cast<uint32_t>(_sdaPin) << 16;
+	}
+	[[nodiscard]] uint8_t getController() const override { return _bus; }
+	[[nodiscard]] bool isI2C() const override { return true; }
+	[[nodiscard]] uint8_t getSclPin() const { return _sclPin; }
+	[[nodiscard]] uint8_t getSdaPin() const { return _sdaPin; }
 
 	[[nodiscard]] std::string toString() const final {
 		using namespace std::string_literals;
-		return "Wire("s + std::to_string(_sclPin) + ": " + std::to_string(_sdaPin)
-			 + ")"s;
+		return (_bus == 0 ? "Wire("s : "Wire"s + std::to_string(_bus) + "("s)
+			 + std::to_string(_sclPin) + ": " + std::to_string(_sdaPin) + ")"s;
 	}
 
 protected:
 	uint8_t _sdaPin;
 	uint8_t _sclPin;
+	uint8_t _bus;
 };
 
 }  // namespace SlimeVR
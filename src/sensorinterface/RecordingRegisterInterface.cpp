@@ -0,0 +1,165 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "RecordingRegisterInterface.h"
+
+#include <cstring>
+
+#include "FSHelper.h"
+
+namespace SlimeVR::Sensors {
+
+std::string ImuRecording::segmentPath(size_t segment) {
+	return std::string(Directory) + "/" + std::to_string(segment) + ".bin";
+}
+
+RecordingRegisterInterface::RecordingRegisterInterface(
+	RegisterInterface& inner,
+	uint8_t sensorId,
+	size_t maxBytes
+)
+	: m_Inner(inner)
+	, m_SensorId(sensorId)
+	, m_SegmentBytes(maxBytes / ImuRecording::SegmentCount)
+	, m_SetupMicros(micros()) {}
+
+RecordingRegisterInterface::~RecordingRegisterInterface() {
+	if (m_Recording) {
+		flush();
+		m_File.close();
+	}
+}
+
+void RecordingRegisterInterface::start(SensorTypeID sensorType) {
+	if (!Utils::ensureDirectory(ImuRecording::Directory)) {
+		return;
+	}
+
+	m_SensorType = sensorType;
+	m_Recording = true;
+	openSegment();
+}
+
+void RecordingRegisterInterface::openSegment() const {
+	if (m_File) {
+		m_File.close();
+	}
+
+	m_File = LittleFS.open(ImuRecording::segmentPath(m_Segment).c_str(), "w");
+	ImuRecording::SegmentHeader header{
+		.magic = ImuRecording::Magic,
+		.sequence = m_Sequence,
+		.setupMicros = m_SetupMicros,
+		.version = ImuRecording::Version,
+		.sensorId = m_SensorId,
+		.sensorType = m_SensorType,
+		.address = m_Inner.getAddress(),
+	};
+	m_File.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+	m_SegmentUsed = sizeof(header);
+}
+
+void RecordingRegisterInterface::flush() const {
+	if (!m_File || m_BufferUsed == 0) {
+		return;
+	}
+
+	if (m_SegmentUsed + m_BufferUsed > m_SegmentBytes) {
+		m_Segment = (m_Segment + 1) % ImuRecording::SegmentCount;
+		m_Sequence++;
+		openSegment();
+	}
+
+	m_File.write(m_Buffer.data(), m_BufferUsed);
+	m_File.flush();
+	m_SegmentUsed += m_BufferUsed;
+	m_BufferUsed = 0;
+}
+
+void RecordingRegisterInterface::record(
+	uint32_t timestamp,
+	uint8_t regAddr,
+	uint8_t size,
+	const uint8_t* data
+) const {
+	if (!m_Recording) {
+		return;
+	}
+
+	if (m_BufferUsed + ImuRecording::RecordHeaderSize + size > m_Buffer.size()) {
+		flush();
+	}
+
+	auto* out = &m_Buffer[m_BufferUsed];
+	memcpy(out, &timestamp, sizeof(timestamp));
+	out[4] = regAddr;
+	out[5] = size;
+	memcpy(out + ImuRecording::RecordHeaderSize, data, size);
+	m_BufferUsed += ImuRecording::RecordHeaderSize + size;
+}
+
+uint8_t RecordingRegisterInterface::readReg(uint8_t regAddr) const {
+	const auto timestamp = micros();
+	const auto value = m_Inner.readReg(regAddr);
+	record(timestamp, regAddr, sizeof(value), &value);
+	return value;
+}
+
+uint16_t RecordingRegisterInterface::readReg16(uint8_t regAddr) const {
+	const auto timestamp = micros();
+	const auto value = m_Inner.readReg16(regAddr);
+	record(timestamp, regAddr, sizeof(value), reinterpret_cast<const uint8_t*>(&value));
+	return value;
+}
+
+void RecordingRegisterInterface::writeReg(uint8_t regAddr, uint8_t value) const {
+	m_Inner.writeReg(regAddr, value);
+}
+
+void RecordingRegisterInterface::writeReg16(uint8_t regAddr, uint16_t value) const {
+	m_Inner.writeReg16(regAddr, value);
+}
+
+void RecordingRegisterInterface::readBytes(
+	uint8_t regAddr,
+	uint8_t size,
+	uint8_t* buffer
+) const {
+	const auto timestamp = micros();
+	m_Inner.readBytes(regAddr, size, buffer);
+	record(timestamp, regAddr, size, buffer);
+}
+
+void RecordingRegisterInterface::writeBytes(
+	uint8_t regAddr,
+	uint8_t size,
+	uint8_t* buffer
+) const {
+	m_Inner.writeBytes(regAddr, size, buffer);
+}
+
+std::string RecordingRegisterInterface::toString() const {
+	return m_Inner.toString();
+}
+
+}  // namespace SlimeVR::Sensors
@@ -0,0 +1,109 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <LittleFS.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "RegisterInterface.h"
+#include "consts.h"
+
+namespace SlimeVR::Sensors {
+
+// File format of IMU recordings. A recording is a ring of two segment files,
+// each starting with a SegmentHeader followed by records of
+// {uint32 micros, uint8 regAddr, uint8 size, uint8 data[size]}, all little
+// endian. The segment with the lower sequence number holds the older reads.
+namespace ImuRecording {
+constexpr const char* Directory = "/imurec";
+constexpr uint32_t Magic = 0x43455253;  // "SREC"
+constexpr uint8_t Version = 1;
+constexpr size_t SegmentCount = 2;
+constexpr size_t RecordHeaderSize = 6;
+
+struct SegmentHeader {
+	uint32_t magic;
+	uint32_t sequence;
+	// micros() when the sensor was constructed, to line up a replay with it
+	uint32_t setupMicros;
+	uint8_t version;
+	uint8_t sensorId;
+	SensorTypeID sensorType;
+	uint8_t address;
+};
+
+std::string segmentPath(size_t segment);
+}  // namespace ImuRecording
+
+// Passes everything through to another register interface and, once started,
+// records every read with its timestamp to LittleFS. The oldest half of the
+// recording is dropped when it reaches maxBytes. Reads are buffered in RAM,
+// but flushing the buffer to flash stalls the sensor loop, so this is a
+// debugging aid only (see DEBUG_RECORD_IMU).
+class RecordingRegisterInterface : public RegisterInterface {
+public:
+	RecordingRegisterInterface(
+		RegisterInterface& inner,
+		uint8_t sensorId,
+		size_t maxBytes
+	);
+	~RecordingRegisterInterface();
+
+	void start(SensorTypeID sensorType);
+	void flush() const;
+
+	[[nodiscard]] uint8_t readReg(uint8_t regAddr) const final;
+	[[nodiscard]] uint16_t readReg16(uint8_t regAddr) const final;
+	void writeReg(uint8_t regAddr, uint8_t value) const final;
+	void writeReg16(uint8_t regAddr, uint16_t value) const final;
+	void readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final;
+	void writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const final;
+	[[nodiscard]] uint8_t getAddress() const final { return m_Inner.getAddress(); }
+	bool hasSensorOnBus() final { return m_Inner.hasSensorOnBus(); }
+	[[nodiscard]] std::string toString() const final;
+
+private:
+	void record(uint32_t timestamp, uint8_t regAddr, uint8_t size, const uint8_t* data)
+		const;
+	void openSegment() const;
+
+	RegisterInterface& m_Inner;
+	const uint8_t m_SensorId;
+	const size_t m_SegmentBytes;
+	const uint32_t m_SetupMicros;
+	SensorTypeID m_SensorType = SensorTypeID::Unknown;
+	bool m_Recording = false;
+
+	mutable File m_File;
+	mutable size_t m_Segment = 0;
+	mutable uint32_t m_Sequence = 0;
+	mutable size_t m_SegmentUsed = 0;
+	mutable std::array<uint8_t, 512> m_Buffer;
+	mutable size_t m_BufferUsed = 0;
+};
+
+}  // namespace SlimeVR::Sensors
@@ -26,7 +26,10 @@
 #include <SPI.h>
 
 #include <cstdint>
+#include <cstring>
 
+#include "../debugging/BusMonitor.h"
+#include "../debugging/Profiler.h"
 #include "../logging/Logger.h"
 #include "DirectSPIInterface.h"
 #include "RegisterInterface.h"
@@ -35,7 +38,7 @@
 
 namespace SlimeVR::Sensors {
 
-struct SPIImpl : public RegisterInterface {
+struct SPIImpl final : public RegisterInterface {
 	SPIImpl(DirectSPIInterface* spi, PinInterface* csPin)
 		: m_spi(spi)
 		, m_csPin(csPin) {
@@ -46,11 +49,14 @@ struct SPIImpl : public RegisterInterface {
 			spiSettings._bitOrder,
 			spiSettings._dataMode
 		);
+		Debugging::busMonitor.setClock(Debugging::Bus::SPI, spiSettings._clock);
 		csPin->pinMode(OUTPUT);
 		csPin->digitalWrite(HIGH);
 	}
 
 	uint8_t readReg(uint8_t regAddr) const override {
+		Debugging::ProfileScope scope{Debugging::ProfileZone::BusRead};
+		Debugging::BusScope bus{Debugging::Bus::SPI, 1};
 		m_spi->beginTransaction(m_csPin);
 
 		m_spi->transfer(regAddr | ICM_READ_FLAG);
@@ -62,6 +68,8 @@ struct SPIImpl : public RegisterInterface {
 	}
 
 	uint16_t readReg16(uint8_t regAddr) const override {
+		Debugging::ProfileScope scope{Debugging::ProfileZone::BusRead};
+		Debugging::BusScope bus{Debugging::Bus::SPI, 2};
 		m_spi->beginTransaction(m_csPin);
 
 		m_spi->transfer(regAddr | ICM_READ_FLAG);
@@ -73,6 +81,7 @@ struct SPIImpl : public RegisterInterface {
 	}
 
 	void writeReg(uint8_t regAddr, uint8_t value) const override {
+		Debugging::BusScope bus{Debugging::Bus::SPI, 1};
 		m_spi->beginTransaction(m_csPin);
 
 		m_spi->transfer(regAddr);
@@ -82,6 +91,7 @@ struct SPIImpl : public RegisterInterface {
 	}
 
 	void writeReg16(uint8_t regAddr, uint16_t value) const override {
+		Debugging::BusScope bus{Debugging::Bus::SPI, 2};
 		m_spi->beginTransaction(m_csPin);
 
 		m_spi->transfer(regAddr);
@@ -92,23 +102,25 @@ struct SPIImpl : public RegisterInterface {
 	}
 
 	void readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const override {
+		Debugging::ProfileScope scope{Debugging::ProfileZone::BusRead};
+		Debugging::BusScope bus{Debugging::Bus::SPI, size};
 		m_spi->beginTransaction(m_csPin);
 
 		m_spi->transfer(regAddr | ICM_READ_FLAG);
-		for (uint8_t i = 0; i < size; ++i) {
-			buffer[i] = m_spi->transfer(0);
-		}
+		// Clocked out as one block, which the cores feed through the SPI
+		// peripheral's 64 byte buffer instead of waiting on every byte
+		memset(buffer, 0, size);
+		m_spi->transfer(buffer, size);
 
 		m_spi->endTransaction(m_csPin);
 	}
 
 	void writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const override {
+		Debugging::BusScope bus{Debugging::Bus::SPI, size};
 		m_spi->beginTransaction(m_csPin);
 
 		m_spi->transfer(regAddr);
-		for (uint8_t i = 0; i < size; ++i) {
-			m_spi->transfer(buffer[i]);
-		}
+		m_spi->writeBytes(buffer, size);
 
 		m_spi->endTransaction(m_csPin);
 	}
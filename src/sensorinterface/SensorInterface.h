@@ -24,6 +24,7 @@
 #ifndef SENSORINTERFACE_H
 #define SENSORINTERFACE_H
 
+#include <cstdint>
 #include <string>
 
 namespace SlimeVR {
@@ -32,6 +33,15 @@ public:
 	virtual bool init() = 0;
 	virtual void swapIn() = 0;
 	[[nodiscard]] virtual std::string toString() const = 0;
+	// Sensors behind the same bus and mux channel share a key, and sorting by it
+	// groups them by bus, then mux, then channel
+	[[nodiscard]] virtual uint32_t getBusKey() const { return 0; }
+	// Bus controller the sensor is read through. Sensors on different controllers
+	// can be read at the same time.
+	[[nodiscard]] virtual uint8_t getController() const { return 0; }
+	[[nodiscard]] virtual bool isI2C() const { return false; }
+	// Fastest I2C clock the devices in front of the sensor are rated for
+	[[nodiscard]] virtual uint32_t getMaxI2CClock() const { return UINT32_MAX; }
 };
 
 class EmptySensorInterface : public SensorInterface {
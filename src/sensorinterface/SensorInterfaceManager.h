@@ -103,9 +103,9 @@ private:
 		return pin != 255 && pin != -1;
 	}};
 	SensorInterface<MCP23X17PinInterface, Adafruit_MCP23X17*, int> mcpPinInterfaces;
-	SensorInterface<I2CWireSensorInterface, int, int> i2cWireInterfaces;
-	SensorInterface<I2CPCASensorInterface, int, int, int, int> pcaWireInterfaces;
-	SensorInterface<Sensors::I2CImpl, uint8_t> i2cImpls;
+	SensorInterface<I2CWireSensorInterface, int, int, int> i2cWireInterfaces;
+	SensorInterface<I2CPCASensorInterface, int, int, int, int, int> pcaWireInterfaces;
+	SensorInterface<Sensors::I2CImpl, uint8_t, uint8_t> i2cImpls;
 	SensorInterface<DirectSPIInterface, SPIClass, SPISettings> directSPIInterfaces;
 	SensorInterface<Sensors::SPIImpl, DirectSPIInterface*, PinInterface*> spiImpls;
 };
@@ -27,68 +27,136 @@
 
 #include <cstdint>
 
+#include "../debugging/BusMonitor.h"
+#include "../debugging/Metrics.h"
+#include "../debugging/Profiler.h"
+#include "I2CClock.h"
+#include "I2CWireSensorInterface.h"
 #include "I2Cdev.h"
 #include "RegisterInterface.h"
 
 namespace SlimeVR::Sensors {
 
-struct I2CImpl : public RegisterInterface {
-	I2CImpl(uint8_t devAddr)
-		: m_devAddr(devAddr) {}
+struct I2CImpl final : public RegisterInterface {
+	// The bus is the I2C controller the device hangs off, see I2CWireSensorInterface
+	I2CImpl(uint8_t devAddr, uint8_t bus = 0)
+		: m_devAddr(devAddr)
+		, m_bus(bus < I2CBusCount ? bus : 0)
+		, m_wire(&i2cWire(m_bus)) {}
 
 	uint8_t readReg(uint8_t regAddr) const override {
+		Debugging::ProfileScope scope{Debugging::ProfileZone::BusRead};
+		Debugging::BusScope bus{Debugging::i2cBus(m_bus), 1};
 		uint8_t buffer = 0;
-		I2Cdev::readByte(m_devAddr, regAddr, &buffer);
+		countErrors(
+			I2Cdev::readByte(m_devAddr, regAddr, &buffer, I2Cdev::readTimeout, m_wire),
+			sizeof(buffer)
+		);
 		return buffer;
 	}
 
 	uint16_t readReg16(uint8_t regAddr) const override {
+		Debugging::ProfileScope scope{Debugging::ProfileZone::BusRead};
+		Debugging::BusScope bus{Debugging::i2cBus(m_bus), 2};
 		uint16_t buffer = 0;
-		I2Cdev::readBytes(
+		const auto result = I2Cdev::readBytes(
 			m_devAddr,
 			regAddr,
 			sizeof(buffer),
-			reinterpret_cast<uint8_t*>(&buffer)
+			reinterpret_cast<uint8_t*>(&buffer),
+			I2Cdev::readTimeout,
+			m_wire
 		);
+		countErrors(result, sizeof(buffer));
 		return buffer;
 	}
 
 	void writeReg(uint8_t regAddr, uint8_t value) const override {
-		I2Cdev::writeByte(m_devAddr, regAddr, value);
+		Debugging::BusScope bus{Debugging::i2cBus(m_bus), 1};
+		checkWrite(I2Cdev::writeByte(m_devAddr, regAddr, value, m_wire));
 	}
 
 	void writeReg16(uint8_t regAddr, uint16_t value) const override {
-		I2Cdev::writeBytes(
+		Debugging::BusScope bus{Debugging::i2cBus(m_bus), 2};
+		checkWrite(I2Cdev::writeBytes(
 			m_devAddr,
 			regAddr,
 			sizeof(value),
-			reinterpret_cast<uint8_t*>(&value)
-		);
+			reinterpret_cast<uint8_t*>(&value),
+			m_wire
+		));
 	}
 
 	void readBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const override {
-		I2Cdev::readBytes(m_devAddr, regAddr, size, buffer);
+		Debugging::ProfileScope scope{Debugging::ProfileZone::BusRead};
+		Debugging::BusScope bus{Debugging::i2cBus(m_bus), size};
+		countErrors(
+			I2Cdev::readBytes(
+				m_devAddr,
+				regAddr,
+				size,
+				buffer,
+				I2Cdev::readTimeout,
+				m_wire
+			),
+			size
+		);
 	}
 
 	void writeBytes(uint8_t regAddr, uint8_t size, uint8_t* buffer) const override {
-		I2Cdev::writeBytes(m_devAddr, regAddr, size, buffer);
+		Debugging::BusScope bus{Debugging::i2cBus(m_bus), size};
+		checkWrite(I2Cdev::writeBytes(m_devAddr, regAddr, size, buffer, m_wire));
 	}
 
 	bool hasSensorOnBus() {
 		// Ask twice, because we're nice like this
-		return I2CSCAN::hasDevOnBus(m_devAddr) || I2CSCAN::hasDevOnBus(m_devAddr);
+		if (m_bus == 0) {
+			return I2CSCAN::hasDevOnBus(m_devAddr) || I2CSCAN::hasDevOnBus(m_devAddr);
+		}
+		return isAcknowledged() || isAcknowledged();
 	}
 
 	uint8_t getAddress() const override { return m_devAddr; }
 
 	std::string toString() const {
 		char buf[16];
-		std::snprintf(buf, sizeof(buf), "I2C(0x%02x)", m_devAddr);
+		if (m_bus == 0) {
+			std::snprintf(buf, sizeof(buf), "I2C(0x%02x)", m_devAddr);
+		} else {
+			std::snprintf(buf, sizeof(buf), "I2C%u(0x%02x)", m_bus, m_devAddr);
+		}
 		return std::string(buf);
 	}
 
 private:
+	bool isAcknowledged() const {
+		m_wire->beginTransmission(m_devAddr);
+		return m_wire->endTransmission() == 0;
+	}
+
+	// I2Cdev returns the number of bytes read in an int8_t, or -1 on a timeout
+	void countErrors(int8_t result, uint8_t size) const {
+		const bool failed = static_cast<uint8_t>(result) != size;
+		i2cClock.recordRead(m_bus, failed);
+		if (!failed) {
+			return;
+		}
+		invalidateI2C(m_bus);
+		Debugging::metrics.increment(
+			result == -1 ? Debugging::Counter::I2CTimeouts
+						 : Debugging::Counter::I2CReadErrors
+		);
+	}
+
+	void checkWrite(bool ok) const {
+		if (!ok) {
+			invalidateI2C(m_bus);
+		}
+	}
+
 	uint8_t m_devAddr;
+	uint8_t m_bus;
+	TwoWire* m_wire;
 };
 
 }  // namespace SlimeVR::Sensors
@@ -43,15 +43,17 @@ uint8_t SensorBuilder::buildAllSensors() {
 	[[maybe_unused]] const auto NO_WIRE = &EmptySensorInterface::instance;
 	[[maybe_unused]] const auto DIRECT_PIN
 		= [&](uint8_t pin) { return interfaceManager.directPinInterface().get(pin); };
-	[[maybe_unused]] const auto DIRECT_WIRE = [&](uint8_t scl, uint8_t sda) {
-		return interfaceManager.i2cWireInterface().get(scl, sda);
-	};
+	// The optional bus picks the I2C controller, Wire or Wire1
+	[[maybe_unused]] const auto DIRECT_WIRE
+		= [&](uint8_t scl, uint8_t sda, uint8_t bus = 0) {
+			  return interfaceManager.i2cWireInterface().get(scl, sda, bus);
+		  };
 	[[maybe_unused]] const auto MCP_PIN = [&](uint8_t pin) {
 		return interfaceManager.mcpPinInterface().get(&m_Manager->m_MCP, pin);
 	};
 	[[maybe_unused]] const auto PCA_WIRE
-		= [&](uint8_t scl, uint8_t sda, uint8_t addr, uint8_t ch) {
-			  return interfaceManager.pcaWireInterface().get(scl, sda, addr, ch);
+		= [&](uint8_t scl, uint8_t sda, uint8_t addr, uint8_t ch, uint8_t bus = 0) {
+			  return interfaceManager.pcaWireInterface().get(scl, sda, addr, ch, bus);
 		  };
 	[[maybe_unused]] const auto DIRECT_SPI
 		= [&](uint32_t clockFreq, uint8_t bitOrder, uint8_t dataMode) {
@@ -45,6 +45,7 @@
 #include "sensorinterface/I2CPCAInterface.h"
 #include "sensorinterface/I2CWireSensorInterface.h"
 #include "sensorinterface/MCP23X17PinInterface.h"
+#include "sensorinterface/RecordingRegisterInterface.h"
 #include "sensorinterface/RegisterInterface.h"
 #include "sensorinterface/SPIImpl.h"
 #include "sensorinterface/SensorInterface.h"
@@ -180,8 +181,10 @@ public:
 		);
 	}
 
+	// Returns the concrete type of the interface, which sensorDescEntry() binds
+	// SoftFusion sensors to
 	template <typename Sensor, typename AccessInterface>
-	RegisterInterface* getRegisterInterface(
+	auto* getRegisterInterface(
 		uint8_t sensorId,
 		SensorInterface* interface,
 		AccessInterface access
@@ -195,12 +198,15 @@ public:
 			);
 		} else if constexpr (std::is_same_v<AccessInterface, bool>) {
 			uint8_t addressIncrement = access ? 1 : 0;
-			return interfaceManager.i2cImpl().get(Sensor::Address + addressIncrement);
+			return interfaceManager.i2cImpl().get(
+				Sensor::Address + addressIncrement,
+				interface->getController()
+			);
 		} else if constexpr (std::is_integral_v<AccessInterface>) {
-			return interfaceManager.i2cImpl().get(access);
+			return interfaceManager.i2cImpl().get(access, interface->getController());
+		} else {
+			return &EmptyRegisterInterface::instance;
 		}
-
-		return &EmptyRegisterInterface::instance;
 	}
 
 	template <typename AccessInterface>
@@ -226,6 +232,13 @@ public:
 			BNO085Sensor>(sensorID, sensorInterface, accessInterface);
 	}
 
+	// An auto-detected entry keeps buildSensorDynamically(), and with it the virtual
+	// variant of every sensor it can build, in the image. Binding the explicit
+	// entries to their interface would then add a second copy of their drivers.
+#define SENSOR_DESC_ENTRY(ImuType, ...) || std::is_same_v<ImuType, SensorAuto>
+	static constexpr bool BindInterfaces = !(false SENSOR_DESC_LIST);
+#undef SENSOR_DESC_ENTRY
+
 	template <typename SensorType, typename AccessInterface>
 	bool sensorDescEntry(
 		uint8_t sensorID,
@@ -274,8 +287,9 @@ public:
 				sensorInterface,
 				accessInterface
 			);
+			using Interface = std::remove_reference_t<decltype(regInterface)>;
 
-			sensor = buildSensor<SensorType>({
+			SensorDefinition sensorDef{
 				sensorID,
 				regInterface,
 				rotation,
@@ -283,7 +297,18 @@ public:
 				optional,
 				intPin,
 				extraParam,
-			});
+			};
+			// The recorder wraps the interface, so it needs the virtual one
+			if constexpr (
+				requires { typename SensorType::template WithInterface<Interface>; }
+				&& BindInterfaces && !DEBUG_RECORD_IMU
+			) {
+				sensor = buildSensor<
+					typename SensorType::template WithInterface<Interface>,
+					Interface>(sensorDef);
+			} else {
+				sensor = buildSensor<SensorType>(sensorDef);
+			}
 		}
 
 		bool working = sensor->isWorking();
@@ -297,7 +322,8 @@ public:
 		return true;
 	}
 
-	template <typename ImuType>
+	// Interface is the type imuInterface is known to have
+	template <typename ImuType, typename Interface = RegisterInterface>
 	std::unique_ptr<::Sensor> buildSensor(SensorDefinition sensorDef) {
 		m_Manager->m_Logger.trace(
 			"Building IMU with: id=%d,\n\
@@ -346,9 +372,23 @@ public:
 			sensorDef.imuInterface.toString().c_str()
 		);
 
+		auto* imuInterface = static_cast<Interface*>(&sensorDef.imuInterface);
+#if DEBUG_RECORD_IMU
+		// Never freed, like the interfaces in SensorInterfaceManager
+		RecordingRegisterInterface* recorder = nullptr;
+		if (sensorDef.sensorID == DEBUG_RECORD_IMU_SENSOR_ID) {
+			recorder = new RecordingRegisterInterface(
+				sensorDef.imuInterface,
+				sensorDef.sensorID,
+				DEBUG_RECORD_IMU_MAX_BYTES
+			);
+			imuInterface = recorder;
+		}
+#endif
+
 		sensor = std::make_unique<ImuType>(
 			sensorDef.sensorID,
-			sensorDef.imuInterface,
+			*imuInterface,
 			sensorDef.rotation,
 			sensorDef.sensorInterface,
 			sensorDef.intPin,
@@ -356,6 +396,12 @@ public:
 		);
 
 		sensor->motionSetup();
+
+#if DEBUG_RECORD_IMU
+		if (recorder != nullptr) {
+			recorder->start(ImuType::TypeID);
+		}
+#endif
 		return sensor;
 	}
 
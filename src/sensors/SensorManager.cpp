@@ -23,12 +23,18 @@
 
 #include "SensorManager.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "SensorBuilder.h"
+#include "debugging/BusMonitor.h"
+#include "debugging/Profiler.h"
 
 namespace SlimeVR::Sensors {
 
 void SensorManager::setup() {
-	if (m_MCP.begin_I2C()) {
+	m_MCPFound = m_MCP.begin_I2C();
+	if (m_MCPFound) {
 		m_Logger.info("MCP initialized");
 	}
 
@@ -43,7 +49,10 @@ void SensorManager::setup() {
 			"in the background"
 		);
 		I2CSCAN::scani2cports();
+		return;
 	}
+
+	negotiateI2CClocks();
 }
 
 void SensorManager::postSetup() {
@@ -57,20 +66,157 @@ void SensorManager::postSetup() {
 	}
 }
 
+namespace {
+
+uint8_t controllerOf(const ::Sensor& sensor) {
+	const auto* interface = sensor.m_hwInterface;
+	if (interface == nullptr) {
+		return 0;
+	}
+	return std::min<uint8_t>(interface->getController(), I2CBusCount - 1);
+}
+
+}  // namespace
+
+void SensorManager::negotiateI2CClocks() {
+	for (uint8_t bus = 0; bus < I2CBusCount; bus++) {
+		// The MCP23X17 sits on Wire, and is only run at Fast-mode like the muxes
+		if (bus == 0 && m_MCPFound) {
+			continue;
+		}
+
+		i2cClock.negotiate(bus, [&](uint32_t clockHz) {
+			bool checked = false;
+			for (auto& sensor : m_Sensors) {
+				auto* interface = sensor->m_hwInterface;
+				if (!sensor->isWorking() || interface == nullptr || !interface->isI2C()
+					|| controllerOf(*sensor) != bus) {
+					continue;
+				}
+				if (clockHz > interface->getMaxI2CClock()) {
+					return false;
+				}
+				interface->swapIn();
+				if (!sensor->checkBus(clockHz)) {
+					return false;
+				}
+				checked = true;
+			}
+			return checked;
+		});
+	}
+}
+
+void SensorManager::scheduleSensors() {
+	auto busKey = [this](size_t index) {
+		const auto* interface = m_Sensors[index]->m_hwInterface;
+		return interface != nullptr ? interface->getBusKey() : 0;
+	};
+
+	std::vector<size_t> byBus(m_Sensors.size());
+	std::iota(byBus.begin(), byBus.end(), 0);
+	std::stable_sort(byBus.begin(), byBus.end(), [&](size_t a, size_t b) {
+		return busKey(a) < busKey(b);
+	});
+
+	std::vector<size_t> byController[I2CBusCount];
+	for (size_t index : byBus) {
+		byController[controllerOf(*m_Sensors[index])].push_back(index);
+	}
+
+	m_UpdateOrder.clear();
+	for (size_t turn = 0; m_UpdateOrder.size() < m_Sensors.size(); turn++) {
+		for (const auto& sensors : byController) {
+			if (turn < sensors.size()) {
+				m_UpdateOrder.push_back(sensors[turn]);
+			}
+		}
+	}
+
+	for (uint8_t controller = 0; controller < I2CBusCount; controller++) {
+		if (!byController[controller].empty() && !m_Readers[controller].isRunning()) {
+			m_Readers[controller].begin(controller);
+		}
+	}
+}
+
+::Sensor* SensorManager::nextWorkingSensor(size_t position, uint8_t controller) {
+	for (size_t i = position + 1; i < m_UpdateOrder.size(); i++) {
+		auto& sensor = m_Sensors[m_UpdateOrder[i]];
+		if (sensor->isWorking() && controllerOf(*sensor) == controller) {
+			return sensor.get();
+		}
+	}
+	return nullptr;
+}
+
+void SensorManager::startPrefetch(size_t position, uint8_t controller) {
+	if (!m_Readers[controller].isRunning() || m_InFlight[controller] != nullptr) {
+		return;
+	}
+	::Sensor* next = nextWorkingSensor(position, controller);
+	if (next != nullptr && next->supportsOverlappedReads() && next->fetchDue()) {
+		m_Readers[controller].start(next);
+		m_InFlight[controller] = next;
+	}
+}
+
+void SensorManager::waitForPrefetch(uint8_t controller) {
+	if (m_InFlight[controller] != nullptr) {
+		m_Readers[controller].wait();
+		m_InFlight[controller] = nullptr;
+	}
+}
+
 void SensorManager::update() {
-	// Gather IMU data
+	Debugging::busMonitor.update();
+
+	if (m_UpdateOrder.size() != m_Sensors.size()) {
+		scheduleSensors();
+	}
+
+	// Gather IMU data. With the readers running, the FIFO of the next sensor on
+	// each controller is fetched while the current one runs its fusion, and the
+	// controllers are read at the same time
 	bool allIMUGood = true;
-	for (auto& sensor : m_Sensors) {
+	for (size_t i = 0; i < m_UpdateOrder.size(); i++) {
+		auto& sensor = m_Sensors[m_UpdateOrder[i]];
 		if (sensor->isWorking()) {
-			if (sensor->m_hwInterface != nullptr) {
-				sensor->m_hwInterface->swapIn();
+			const uint8_t controller = controllerOf(*sensor);
+			for (uint8_t other = 0; other < I2CBusCount; other++) {
+				if (other != controller) {
+					startPrefetch(i, other);
+				}
 			}
+
+			const bool prefetched = m_InFlight[controller] == sensor.get();
+			waitForPrefetch(controller);
+			if (!prefetched) {
+				if (sensor->m_hwInterface != nullptr) {
+					sensor->m_hwInterface->swapIn();
+				}
+				if (sensor->supportsOverlappedReads()) {
+					sensor->fetchSamples();
+				}
+			}
+
+			// Other sensors read their bus from motionLoop()
+			if (sensor->supportsOverlappedReads()) {
+				startPrefetch(i, controller);
+			}
+
 			sensor->motionLoop();
 		}
 		if (sensor->getSensorState() == SensorStatus::SENSOR_ERROR) {
 			allIMUGood = false;
 		}
 	}
+	// Every fetch started is for a sensor later in the order, this only keeps
+	// sendData() and the clock fallback from racing one
+	for (uint8_t controller = 0; controller < I2CBusCount; controller++) {
+		waitForPrefetch(controller);
+	}
+	i2cClock.update();
 
 	statusManager.setStatus(SlimeVR::Status::IMU_ERROR, !allIMUGood);
 
@@ -106,6 +252,8 @@ void SensorManager::update() {
 	m_LastBundleSentAtMicros = now;
 #endif
 
+	Debugging::ProfileScope scope{Debugging::ProfileZone::PacketBuild};
+
 #if PACKET_BUNDLING != PACKET_BUNDLING_DISABLED
 	networkConnection.beginBundle();
 #endif
@@ -29,9 +29,11 @@
 
 #include "EmptySensor.h"
 #include "ErroneousSensor.h"
+#include "SensorReader.h"
 #include "globals.h"
 #include "logging/Logger.h"
 #include "sensorinterface/DirectPinInterface.h"
+#include "sensorinterface/I2CClock.h"
 #include "sensorinterface/I2CPCAInterface.h"
 #include "sensorinterface/I2CWireSensorInterface.h"
 #include "sensorinterface/MCP23X17PinInterface.h"
@@ -58,13 +60,34 @@ public:
 	}
 
 private:
+	// Orders the updates by bus and mux channel, so that sensors sharing one are
+	// read one after another and the mux is switched once per channel. Sensors on
+	// different controllers take turns, so that each can be read ahead.
+	void scheduleSensors();
+	// First working sensor on the controller after the given position
+	::Sensor* nextWorkingSensor(size_t position, uint8_t controller);
+	// Reads ahead on the controller if its next sensor has samples due
+	void startPrefetch(size_t position, uint8_t controller);
+	void waitForPrefetch(uint8_t controller);
+	// Raises the clock of each I2C controller as far as its sensors allow
+	void negotiateI2CClocks();
+
 	SlimeVR::Logging::Logger m_Logger;
 
 	std::vector<std::unique_ptr<::Sensor>> m_Sensors;
+	// Indices into m_Sensors, redone when the sensor count changes
+	std::vector<size_t> m_UpdateOrder;
 	Adafruit_MCP23X17 m_MCP;
+	bool m_MCPFound = false;
 
 	uint32_t m_LastBundleSentAtMicros = micros();
 
+	// One per bus controller, so that the controllers are read at the same time.
+	// Started when scheduling rather than in setup(), which the native benchmarks
+	// skip.
+	SensorReader m_Readers[I2CBusCount];
+	::Sensor* m_InFlight[I2CBusCount] = {};
+
 	friend class SensorBuilder;
 };
 }  // namespace SlimeVR::Sensors
@@ -0,0 +1,143 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "SensorReader.h"
+
+#include "debugging/Profiler.h"
+#include "sensor.h"
+#include "sensorinterface/I2CWireSensorInterface.h"
+
+namespace SlimeVR::Sensors {
+
+static_assert(
+	!USE_OVERLAPPED_SENSOR_READS || 1 + I2CBusCount <= Debugging::MaxProfileTasks
+);
+
+void SensorReader::fetch() {
+	if (m_Sensor->m_hwInterface != nullptr) {
+		m_Sensor->m_hwInterface->swapIn();
+	}
+	m_Sensor->fetchSamples();
+}
+
+#if USE_OVERLAPPED_SENSOR_READS && ESP32
+
+bool SensorReader::begin(uint8_t controller) {
+	m_Controller = controller;
+	m_Done = xSemaphoreCreateBinary();
+	if (m_Done == nullptr) {
+		return false;
+	}
+
+	// Same priority as the main loop, on the other core
+	const BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+	m_Running = xTaskCreatePinnedToCore(
+					[](void* reader) { static_cast<SensorReader*>(reader)->run(); },
+					"sensor reader",
+					4096,
+					this,
+					uxTaskPriorityGet(nullptr),
+					&m_Task,
+					core
+				)
+			 == pdPASS;
+	return m_Running;
+}
+
+void SensorReader::start(Sensor* sensor) {
+	m_Sensor = sensor;
+	xTaskNotifyGive(m_Task);
+}
+
+void SensorReader::wait() { xSemaphoreTake(m_Done, portMAX_DELAY); }
+
+void SensorReader::run() {
+	Debugging::profileTask = 1 + m_Controller;
+	while (true) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		fetch();
+		xSemaphoreGive(m_Done);
+	}
+}
+
+#elif USE_OVERLAPPED_SENSOR_READS && defined(SLIMEVR_NATIVE)
+
+SensorReader::~SensorReader() {
+	if (!m_Running) {
+		return;
+	}
+	{
+		std::lock_guard lock{m_Mutex};
+		m_Stopping = true;
+	}
+	m_Condition.notify_all();
+	m_Thread.join();
+}
+
+bool SensorReader::begin(uint8_t controller) {
+	m_Controller = controller;
+	m_Thread = std::thread([this]() { run(); });
+	m_Running = true;
+	return true;
+}
+
+void SensorReader::start(Sensor* sensor) {
+	{
+		std::lock_guard lock{m_Mutex};
+		m_Sensor = sensor;
+		m_Pending = true;
+	}
+	m_Condition.notify_all();
+}
+
+void SensorReader::wait() {
+	std::unique_lock lock{m_Mutex};
+	m_Condition.wait(lock, [this]() { return !m_Pending; });
+}
+
+void SensorReader::run() {
+	Debugging::profileTask = 1 + m_Controller;
+	std::unique_lock lock{m_Mutex};
+	while (true) {
+		m_Condition.wait(lock, [this]() { return m_Pending || m_Stopping; });
+		if (m_Stopping) {
+			return;
+		}
+		lock.unlock();
+		fetch();
+		lock.lock();
+		m_Pending = false;
+		m_Condition.notify_all();
+	}
+}
+
+#else
+
+bool SensorReader::begin(uint8_t controller) { return false; }
+void SensorReader::start(Sensor* sensor) {}
+void SensorReader::wait() {}
+void SensorReader::run() {}
+
+#endif
+
+}  // namespace SlimeVR::Sensors
@@ -0,0 +1,84 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "debug.h"
+
+#if USE_OVERLAPPED_SENSOR_READS && defined(SLIMEVR_NATIVE)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+class Sensor;
+
+namespace SlimeVR::Sensors {
+
+/*
+ * Runs Sensor::fetchSamples() on a task of its own, on the core the main loop
+ * doesn't use, so that waiting on the bus for one sensor overlaps with the fusion
+ * of another. One fetch is in flight at a time, and the main loop must not use
+ * the bus until it has waited for it.
+ */
+class SensorReader {
+public:
+#if USE_OVERLAPPED_SENSOR_READS && defined(SLIMEVR_NATIVE)
+	~SensorReader();
+#endif
+
+	// Starts the task reading from the given I2C controller, false where overlapped
+	// reads are compiled out or the task couldn't be created
+	bool begin(uint8_t controller);
+	[[nodiscard]] bool isRunning() const { return m_Running; }
+
+	// Swaps in the sensor's interface and fetches its samples on the task
+	void start(Sensor* sensor);
+	// Blocks until the fetch started last is done
+	void wait();
+
+private:
+	void run();
+	void fetch();
+
+	Sensor* m_Sensor = nullptr;
+	uint8_t m_Controller = 0;
+	bool m_Running = false;
+
+#if USE_OVERLAPPED_SENSOR_READS && ESP32
+	TaskHandle_t m_Task = nullptr;
+	// Given when a fetch is done. Each reader has its own, so that waiting on one
+	// can't be woken by another finishing.
+	SemaphoreHandle_t m_Done = nullptr;
+#elif USE_OVERLAPPED_SENSOR_READS && defined(SLIMEVR_NATIVE)
+	std::thread m_Thread;
+	std::mutex m_Mutex;
+	std::condition_variable m_Condition;
+	bool m_Pending = false;
+	bool m_Stopping = false;
+#endif
+};
+
+}  // namespace SlimeVR::Sensors
@@ -26,6 +26,7 @@
 
 #include "GlobalVars.h"
 #include "calibration.h"
+#include "debugging/Metrics.h"
 
 // seconds after previous save (from start) when calibration (DMP Bias) data will be
 // saved to NVS. Increments through the list then stops; to prevent unwelcome eeprom
@@ -327,6 +328,9 @@ void ICM20948Sensor::checkSensorTimeout() {
 	unsigned long currenttime = millis();
 	if (lastData + 2000 < currenttime) {
 		working = false;
+		SlimeVR::Debugging::metrics.increment(
+			SlimeVR::Debugging::Counter::SensorTimeouts
+		);
 		m_Logger.error(
 			"Sensor timeout I2C Address 0x%02x delaytime: %ld ms",
 			addr,
@@ -510,7 +514,7 @@ void ICM20948Sensor::calculateAccelerationWithoutGravity(Quat* quaternion) {
 		if ((dmpData.header & DMP_header_bitmap_Accel) > 0) {
 			sfusion.updateQuaternion(*quaternion);
 
-			float Axyz[3]
+			sensor_real_t Axyz[3]
 				= {(float)this->dmpData.Raw_Accel.Data.X * ASCALE_4G,
 				   (float)this->dmpData.Raw_Accel.Data.Y * ASCALE_4G,
 				   (float)this->dmpData.Raw_Accel.Data.Z * ASCALE_4G};
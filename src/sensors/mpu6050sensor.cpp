@@ -178,7 +178,7 @@ void MPU6050Sensor::motionLoop() {
 		{
 			this->imu.dmpGetAccel(&this->rawAccel, this->fifoBuffer);
 
-			float Axyz[3]
+			sensor_real_t Axyz[3]
 				= {(float)rawAccel.x * ASCALE_2G,
 				   (float)rawAccel.y * ASCALE_2G,
 				   (float)rawAccel.z * ASCALE_2G};
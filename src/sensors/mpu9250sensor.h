@@ -87,9 +87,9 @@ private:
 #endif
 
 	// raw data and scaled as vector
-	float Axyz[3]{};
-	float Gxyz[3]{};
-	float Mxyz[3]{};
+	sensor_real_t Axyz[3]{};
+	sensor_real_t Gxyz[3]{};
+	sensor_real_t Mxyz[3]{};
 	VectorInt16 rawAccel{};
 	Quat correction{0, 0, 0, 0};
 
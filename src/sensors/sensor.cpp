@@ -37,13 +37,16 @@ void Sensor::setAcceleration(Vector3 a) {
 	newAcceleration = true;
 }
 
-void Sensor::setFusedRotation(Quat r) {
+void Sensor::setFusedRotation(Quat r) { setFusedRotation(r, micros()); }
+
+void Sensor::setFusedRotation(Quat r, uint32_t readMicros) {
 	fusedRotation = r * sensorOffset;
 	bool changed = OPTIMIZE_UPDATES
 					 ? !lastFusedRotationSent.equalsWithEpsilon(fusedRotation)
 					 : true;
 	if (ENABLE_INSPECTION || changed) {
 		newFusedRotation = true;
+		fusedRotationMicros = readMicros;
 		lastFusedRotationSent = fusedRotation;
 	}
 	if (changed) {
@@ -60,6 +63,7 @@ void Sensor::sendData() {
 			DATA_TYPE_NORMAL,
 			calibrationAccuracy
 		);
+		m_sendLatency.record(micros() - fusedRotationMicros);
 
 #ifdef DEBUG_SENSOR
 		m_Logger.trace("Quaternion: %f, %f, %f, %f", UNPACK_QUATERNION(fusedRotation));
@@ -33,6 +33,7 @@
 #include "PinInterface.h"
 #include "SensorToggles.h"
 #include "configuration/Configuration.h"
+#include "debugging/LogHistogram.h"
 #include "globals.h"
 #include "logging/Logger.h"
 #include "sensorinterface/RegisterInterface.h"
@@ -76,9 +77,21 @@ public:
 	virtual void motionSetup(){};
 	virtual void postSetup(){};
 	virtual void motionLoop(){};
+	// Sensors that keep all bus access of motionLoop() in fetchSamples() can have
+	// it run on the sensor reader, overlapping with other sensors' motionLoop()
+	[[nodiscard]] virtual bool supportsOverlappedReads() const { return false; }
+	// Whether fetchSamples() would read the FIFO, judged without bus access
+	[[nodiscard]] virtual bool fetchDue() const { return false; }
+	virtual void fetchSamples(){};
+	// Reads the sensor back on a bus running at the given clock, false if it
+	// answered wrong or isn't rated for that clock
+	virtual bool checkBus(uint32_t clockHz) { return false; }
 	virtual void sendData();
 	virtual void setAcceleration(Vector3 a);
-	virtual void setFusedRotation(Quat r);
+	// readMicros being when the samples behind it were read off the sensor. The
+	// one to override, the other form forwards to it with the current time
+	virtual void setFusedRotation(Quat r, uint32_t readMicros);
+	void setFusedRotation(Quat r);
 	virtual void startCalibration(int calibrationType){};
 	virtual SensorStatus getSensorState();
 	virtual void printTemperatureCalibrationState();
@@ -117,6 +130,9 @@ public:
 
 	TPSCounter m_tpsCounter;
 	TPSCounter m_dataCounter;
+	// From the samples behind a rotation being read to it being sent, reset by the
+	// telemetry
+	SlimeVR::Debugging::LogHistogram m_sendLatency;
 	SlimeVR::SensorInterface* m_hwInterface = nullptr;
 
 protected:
@@ -134,6 +150,7 @@ protected:
 	Quat sensorOffset;
 
 	bool newFusedRotation = false;
+	uint32_t fusedRotationMicros = 0;
 	Quat fusedRotation{};
 	Quat lastFusedRotationSent{};
 
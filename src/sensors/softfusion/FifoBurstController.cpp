@@ -0,0 +1,56 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#include "FifoBurstController.h"
+
+#include <algorithm>
+
+namespace SlimeVR::Sensors::SoftFusion {
+
+void FifoBurstController::beginDrain(uint32_t now) {
+	// The first drain has no previous one to measure from, and gets the minimum
+	const uint32_t loopPeriod = m_HasDrained ? now - m_LastDrainMicros : 0;
+	m_LastDrainMicros = now;
+	m_HasDrained = true;
+	m_BudgetMicros = std::max(
+		MinBudgetMicros,
+		static_cast<uint32_t>(static_cast<float>(loopPeriod) * BudgetShare)
+	);
+}
+
+bool FifoBurstController::canContinue(uint8_t bursts, uint32_t elapsedMicros)
+	const {
+	// Don't start a burst that would likely end past the budget
+	return bursts < MaxBursts && elapsedMicros + m_BurstMicros <= m_BudgetMicros;
+}
+
+void FifoBurstController::recordBurst(uint32_t micros) {
+	constexpr float Smoothing = 0.1f;
+	if (m_BurstMicros == 0) {
+		m_BurstMicros = static_cast<float>(micros);
+		return;
+	}
+	m_BurstMicros += (static_cast<float>(micros) - m_BurstMicros) * Smoothing;
+}
+
+}  // namespace SlimeVR::Sensors::SoftFusion
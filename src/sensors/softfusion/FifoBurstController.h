@@ -0,0 +1,53 @@
+/*
+	SlimeVR Code is placed under the MIT license
+	Copyright (c) 2025 SlimeVR Contributors
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in
+	all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+	THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace SlimeVR::Sensors::SoftFusion {
+
+// Decides how many FIFO bursts a sensor reads per loop. A burst is capped by the
+// driver's read buffer, so when the FIFO holds more the backlog is drained with
+// further bursts while the measured burst time, which depends on the bus speed,
+// fits a budget. The budget is a share of the time since the previous drain, so
+// slow loops that let the FIFO fill up get to read more of it.
+class FifoBurstController {
+public:
+	static constexpr uint8_t MaxBursts = 4;
+	static constexpr uint32_t MinBudgetMicros = 2000;
+	static constexpr float BudgetShare = 0.25f;
+
+	void beginDrain(uint32_t now);
+	[[nodiscard]] bool canContinue(uint8_t bursts, uint32_t elapsedMicros) const;
+	void recordBurst(uint32_t micros);
+
+private:
+	// Moving average of the time a single burst takes
+	float m_BurstMicros = 0;
+	uint32_t m_BudgetMicros = MinBudgetMicros;
+	uint32_t m_LastDrainMicros = 0;
+	bool m_HasDrained = false;
+};
+
+}  // namespace SlimeVR::Sensors::SoftFusion
@@ -71,7 +71,7 @@ public:
 				lastSecondsRemaining = currentSecondsRemaining;
 			}
 
-			sensor.bulkRead({
+			sensor.bulkRead(DriverCallbacks{
 				[](const RawSensorT xyz[3], const sensor_real_t timeDelta) {},
 				[](const RawSensorT xyz[3], const sensor_real_t timeDelta) {},
 				[](const int16_t xyz, const sensor_real_t timeDelta) {},
@@ -87,7 +87,7 @@ public:
 		int16_t temp = 0;
 		const auto targetDelay = millis() + milliseconds;
 		while (millis() < targetDelay) {
-			sensor.bulkRead({
+			sensor.bulkRead(DriverCallbacks{
 				[&](const RawSensorT xyz[3], const sensor_real_t timeDelta) {
 					accel[0] = xyz[0];
 					accel[1] = xyz[1];
@@ -288,7 +288,7 @@ private:
 #ifdef ESP8266
 			ESP.wdtFeed();
 #endif
-			sensor.bulkRead({
+			sensor.bulkRead(DriverCallbacks{
 				[](const RawSensorT xyz[3], const sensor_real_t timeDelta) {},
 				[&sumXYZ,
 				 &sampleCount](const RawSensorT xyz[3], const sensor_real_t timeDelta) {
@@ -362,7 +362,7 @@ private:
 #ifdef ESP8266
 			ESP.wdtFeed();
 #endif
-			sensor.bulkRead({
+			sensor.bulkRead(DriverCallbacks{
 				[&](const RawSensorT xyz[3], const sensor_real_t timeDelta) {
 					const sensor_real_t scaledData[]
 						= {static_cast<sensor_real_t>(
@@ -464,7 +464,7 @@ private:
 		logger.debug("Counting samples now...");
 		uint32_t currentTime;
 		while ((currentTime = millis()) < calibTarget) {
-			sensor.bulkRead({
+			sensor.bulkRead(DriverCallbacks{
 				[&](const RawSensorT xyz[3], const sensor_real_t timeDelta) {
 					accelSamples++;
 				},
@@ -43,6 +43,7 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 
 // Sensorhub to be implemented
 
+template <typename RegInterface>
 struct BMI160 {
 	static constexpr uint8_t Address = 0x68;
 	static constexpr auto Name = "BMI160";
@@ -61,10 +62,10 @@ struct BMI160 {
 
 	static constexpr VQFParams SensorVQFParams{};
 
-	RegisterInterface& m_RegisterInterface;
+	RegInterface& m_RegisterInterface;
 	SlimeVR::Logging::Logger& m_Logger;
 
-	BMI160(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+	BMI160(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
 		: m_RegisterInterface(registerInterface)
 		, m_Logger(logger) {}
 
@@ -110,6 +111,29 @@ struct BMI160 {
 				= 0b11010000;  // Gyro and accel data in FIFO, enable FIFO header
 		};
 
+		static constexpr uint8_t FifoWatermark = 0x46;  // in 4 byte units
+
+		struct IntEn1 {
+			static constexpr uint8_t reg = 0x51;
+			static constexpr uint8_t value = (1 << 6);  // fifo watermark enabled
+		};
+
+		struct IntOutCtrl {
+			static constexpr uint8_t reg = 0x53;
+			static constexpr uint8_t value
+				= (1 << 3) | (1 << 1);  // output en, active high, push-pull
+		};
+
+		struct IntLatch {
+			static constexpr uint8_t reg = 0x54;
+			static constexpr uint8_t value = 0x0;  // non latched
+		};
+
+		struct IntMap1 {
+			static constexpr uint8_t reg = 0x56;
+			static constexpr uint8_t value = (1 << 6);  // fifo watermark on INT1
+		};
+
 		static constexpr uint8_t FifoLength = 0x22;
 		static constexpr uint8_t FifoData = 0x24;
 		static constexpr uint8_t ErrReg = 0x02;
@@ -122,6 +146,9 @@ struct BMI160 {
 
 		static constexpr uint8_t GyrDataBit = 0b00001000;
 		static constexpr uint8_t AccelDataBit = 0b00000100;
+
+		static constexpr size_t HeaderSize = 1;
+		static constexpr size_t SampleSize = 6;
 	};
 
 	bool initialize() {
@@ -156,6 +183,22 @@ struct BMI160 {
 		}
 	}
 
+	// Raises INT1 once the FIFO holds readInterval worth of frames
+	void setupFifoInterrupt(float readInterval) {
+		const auto gyroFrames = std::max<size_t>(readInterval / GyrTs, 1);
+		const auto accelSamples = static_cast<size_t>(readInterval / AccTs);
+		const auto bytes = gyroFrames * (Fifo::HeaderSize + Fifo::SampleSize)
+						 + accelSamples * Fifo::SampleSize;
+		m_RegisterInterface.writeReg(
+			Regs::FifoWatermark,
+			static_cast<uint8_t>((bytes + 3) / 4)
+		);
+		m_RegisterInterface.writeReg(Regs::IntOutCtrl::reg, Regs::IntOutCtrl::value);
+		m_RegisterInterface.writeReg(Regs::IntLatch::reg, Regs::IntLatch::value);
+		m_RegisterInterface.writeReg(Regs::IntMap1::reg, Regs::IntMap1::value);
+		m_RegisterInterface.writeReg(Regs::IntEn1::reg, Regs::IntEn1::value);
+	}
+
 	float getDirectTemp() const {
 		// 0x0 is 23C
 		// Resolution is 1/2^9 K / LSB
@@ -177,7 +220,8 @@ struct BMI160 {
 		return to_ret;
 	}
 
-	bool bulkRead(DriverCallbacks<int16_t>&& callbacks) {
+	template <DriverCallbacksFor<int16_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
 		const auto fifo_bytes = m_RegisterInterface.readReg16(Regs::FifoLength) & 0x7FF;
 
 		const auto bytes_to_read = std::min(
@@ -41,8 +41,10 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // Gyroscope ODR = 200Hz, accel ODR = 100Hz
 // Timestamps reading are not used
 
+template <typename RegInterface>
 struct BMI270 {
 	static constexpr uint8_t Address = 0x68;
+	static constexpr uint32_t MaxI2CClock = 1000000;  // Fast-mode Plus
 	static constexpr auto Name = "BMI270";
 	static constexpr auto Type = SensorTypeID::BMI270;
 
@@ -63,13 +65,15 @@ struct BMI270 {
 		uint8_t x, y, z;
 	};
 
-	RegisterInterface& m_RegisterInterface;
+	RegInterface& m_RegisterInterface;
 	SlimeVR::Logging::Logger& m_Logger;
 	int8_t m_zxFactor;
-	BMI270(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+	uint16_t m_fifoWatermark;
+	BMI270(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
 		: m_RegisterInterface(registerInterface)
 		, m_Logger(logger)
-		, m_zxFactor(0) {}
+		, m_zxFactor(0)
+		, m_fifoWatermark(0) {}
 
 	struct Regs {
 		struct WhoAmI {
@@ -223,6 +227,24 @@ struct BMI270 {
 		static constexpr uint8_t GyrUserGain
 			= 0x78;  // undocumented reg, got from official bmi270 driver
 
+		static constexpr uint8_t FifoWatermark = 0x46;
+
+		struct Int1IoCtrl {
+			static constexpr uint8_t reg = 0x53;
+			static constexpr uint8_t value
+				= (1 << 3) | (1 << 1);  // output en, active high, push-pull
+		};
+
+		struct IntLatch {
+			static constexpr uint8_t reg = 0x55;
+			static constexpr uint8_t value = 0x0;  // non latched
+		};
+
+		struct IntMapData {
+			static constexpr uint8_t reg = 0x58;
+			static constexpr uint8_t value = (1 << 1);  // fifo watermark on INT1
+		};
+
 		static constexpr uint8_t FifoCount = 0x24;
 		static constexpr uint8_t FifoData = 0x26;
 		static constexpr uint8_t RaGyrCas = 0x3c;  // on feature page 0!
@@ -235,6 +257,9 @@ struct BMI270 {
 
 		static constexpr uint8_t GyrDataBit = 0b00001000;
 		static constexpr uint8_t AccelDataBit = 0b00000100;
+
+		static constexpr size_t HeaderSize = 1;
+		static constexpr size_t SampleSize = 6;
 	};
 
 	bool restartAndInit() {
@@ -316,11 +341,32 @@ struct BMI270 {
 		m_RegisterInterface.writeReg(Regs::FifoConfig0::reg, Regs::FifoConfig0::value);
 		m_RegisterInterface.writeReg(Regs::FifoConfig1::reg, Regs::FifoConfig1::value);
 
+		if (m_fifoWatermark) {
+			writeFifoInterruptConfig();
+		}
+
 		delay(4);
 		m_RegisterInterface.writeReg(Regs::Cmd::reg, Regs::Cmd::valueFifoFlush);
 		delay(2);
 	}
 
+	void writeFifoInterruptConfig() {
+		m_RegisterInterface.writeReg16(Regs::FifoWatermark, m_fifoWatermark);
+		m_RegisterInterface.writeReg(Regs::Int1IoCtrl::reg, Regs::Int1IoCtrl::value);
+		m_RegisterInterface.writeReg(Regs::IntLatch::reg, Regs::IntLatch::value);
+		m_RegisterInterface.writeReg(Regs::IntMapData::reg, Regs::IntMapData::value);
+	}
+
+	// Raises INT1 once the FIFO holds readInterval worth of frames, the config is
+	// reapplied by setNormalConfig as calibration resets the chip
+	void setupFifoInterrupt(float readInterval) {
+		const auto gyroFrames = std::max<size_t>(readInterval / GyrTs, 1);
+		const auto accelSamples = static_cast<size_t>(readInterval / AccTs);
+		m_fifoWatermark = gyroFrames * (Fifo::HeaderSize + Fifo::SampleSize)
+						+ accelSamples * Fifo::SampleSize;
+		writeFifoInterruptConfig();
+	}
+
 	bool initialize(MotionlessCalibrationData& gyroSensitivity) {
 		if (!restartAndInit()) {
 			return false;
@@ -428,7 +474,8 @@ struct BMI270 {
 		return to_ret;
 	}
 
-	bool bulkRead(DriverCallbacks<int16_t>&& callbacks) {
+	template <DriverCallbacksFor<int16_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
 		const auto fifo_bytes = m_RegisterInterface.readReg16(Regs::FifoCount);
 
 		const auto bytes_to_read = std::min(
@@ -24,11 +24,28 @@
 #pragma once
 
 #include <cstdint>
-#include <functional>
 
-template <typename SampleType>
+// The callables are template parameters so the sample processing inlines into
+// the FIFO parse loops, build it with DriverCallbacks{accel, gyro, temp}
+template <typename AccelCallback, typename GyroCallback, typename TempCallback>
 struct DriverCallbacks {
-	std::function<void(const SampleType sample[3], float AccTs)> processAccelSample;
-	std::function<void(const SampleType sample[3], float GyrTs)> processGyroSample;
-	std::function<void(int16_t sample, float TempTs)> processTempSample;
+	AccelCallback processAccelSample;
+	GyroCallback processGyroSample;
+	TempCallback processTempSample;
+};
+
+template <typename AccelCallback, typename GyroCallback, typename TempCallback>
+DriverCallbacks(AccelCallback, GyroCallback, TempCallback)
+	-> DriverCallbacks<AccelCallback, GyroCallback, TempCallback>;
+
+template <typename Callbacks, typename SampleType>
+concept DriverCallbacksFor = requires(
+	Callbacks& callbacks,
+	const SampleType sample[3],
+	int16_t temperature,
+	float timestep
+) {
+	callbacks.processAccelSample(sample, timestep);
+	callbacks.processGyroSample(sample, timestep);
+	callbacks.processTempSample(temperature, timestep);
 };
@@ -27,6 +27,7 @@
 #include <array>
 #include <cstdint>
 
+#include "../../../sensorinterface/RegisterInterface.h"
 #include "callbacks.h"
 #include "vqf.h"
 
@@ -39,8 +40,10 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // Gyroscope ODR = 200Hz, accel ODR = 100Hz
 // Timestamps reading not used, as they're useless (constant predefined increment)
 
+template <typename RegInterface>
 struct ICM42688 {
 	static constexpr uint8_t Address = 0x68;
+	static constexpr uint32_t MaxI2CClock = 1000000;  // Fast-mode Plus
 	static constexpr auto Name = "ICM-42688";
 	static constexpr auto Type = SensorTypeID::ICM42688;
 
@@ -66,9 +69,9 @@ struct ICM42688 {
 
 	static constexpr VQFParams SensorVQFParams{};
 
-	RegisterInterface& m_RegisterInterface;
+	RegInterface& m_RegisterInterface;
 	SlimeVR::Logging::Logger& m_Logger;
-	ICM42688(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+	ICM42688(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
 		: m_RegisterInterface(registerInterface)
 		, m_Logger(logger) {}
 
@@ -115,6 +118,34 @@ struct ICM42688 {
 				= 0b11 | (0b11 << 2);  // accel in low noise mode, gyro in low noise
 		};
 
+		struct IntConfig {
+			static constexpr uint8_t reg = 0x14;
+			static constexpr uint8_t value
+				= 0b1 | (0b1 << 1) | (0b1 << 2);  // INT1 active high, push-pull,
+												  // latched
+		};
+		struct FifoConfig1WatermarkGreater {
+			static constexpr uint8_t reg = 0x5f;
+			static constexpr uint8_t value
+				= FifoConfig1::value | (0b1 << 5);  // keep the watermark interrupt
+													// while above it
+		};
+		static constexpr uint8_t FifoWatermark = 0x60;  // 12 bits over 2 registers
+		struct IntConfig0 {
+			static constexpr uint8_t reg = 0x63;
+			static constexpr uint8_t value
+				= (0b10 << 2);  // clear the watermark interrupt on FIFO data read
+		};
+		struct IntConfig1 {
+			static constexpr uint8_t reg = 0x64;
+			static constexpr uint8_t value
+				= 0;  // INT_ASYNC_RESET = 0, needed for INT1 to work properly
+		};
+		struct IntSource0 {
+			static constexpr uint8_t reg = 0x65;
+			static constexpr uint8_t value = (0b1 << 2);  // FIFO watermark on INT1
+		};
+
 		// TODO: might be worth checking
 		// GYRO_CONFIG1
 		// GYRO_ACCEL_CONFIG0
@@ -122,6 +153,7 @@ struct ICM42688 {
 
 		static constexpr uint8_t FifoCount = 0x2e;
 		static constexpr uint8_t FifoData = 0x30;
+		static constexpr uint8_t FifoEmptyHeader = 0x80;
 	};
 
 #pragma pack(push, 1)
@@ -197,6 +229,20 @@ struct ICM42688 {
 	// max 4 readings in highres mode 8 readings delay too high 6 seems to be the
 	// edge to work reliably. Tested on ESP8266 with 2 IMU
 	static constexpr size_t MaxReadings = DEBUG_ICM42688_HIRES ? 4 : 8;
+	static constexpr size_t FifoCountSize = sizeof(uint16_t);
+	// The count and the burst have to fit the Wire buffer, I2Cdev splits longer
+	// reads and starts the second part over at FifoCount
+	static constexpr size_t MaxSpeculativeEntries = std::min(
+		MaxReadings,
+		(RegisterInterface::MaxTransactionLength - FifoCountSize) / FullFifoEntrySize
+	);
+
+	// Entries the next read fetches along with the count. Follows the FIFO level up
+	// at once but only shrinks after a run of smaller reads, so the short follow-up
+	// reads of a drain don't make the next poll come up short
+	static constexpr uint8_t SpeculationShrinkReads = 16;
+	size_t m_speculativeEntries = 1;
+	uint8_t m_smallerReads = 0;
 
 	bool initialize() {
 		// perform initialization step
@@ -217,25 +263,57 @@ struct ICM42688 {
 		return true;
 	}
 
-	bool bulkRead(DriverCallbacks<int32_t>&& callbacks) {
-		const auto fifo_bytes = m_RegisterInterface.readReg16(Regs::FifoCount);
+	// Raises INT1 once the FIFO holds readInterval worth of entries
+	void setupFifoInterrupt(float readInterval) {
+		const auto entries = std::max<size_t>(readInterval / GyrTs, 1);
+		m_RegisterInterface.writeReg(Regs::IntConfig::reg, Regs::IntConfig::value);
+		m_RegisterInterface.writeReg(Regs::IntConfig0::reg, Regs::IntConfig0::value);
+		m_RegisterInterface.writeReg(Regs::IntConfig1::reg, Regs::IntConfig1::value);
+		m_RegisterInterface.writeReg16(
+			Regs::FifoWatermark,
+			entries * FullFifoEntrySize
+		);
+		m_RegisterInterface.writeReg(
+			Regs::FifoConfig1WatermarkGreater::reg,
+			Regs::FifoConfig1WatermarkGreater::value
+		);
+		m_RegisterInterface.writeReg(Regs::IntSource0::reg, Regs::IntSource0::value);
+	}
+
+	template <DriverCallbacksFor<int32_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
+		// FifoData follows FifoCount and doesn't auto-increment, so the count and a
+		// speculative burst come in one transaction. Entries past the end of the
+		// FIFO read as empty headers and are skipped.
+		std::array<uint8_t, FifoCountSize + FullFifoEntrySize * MaxSpeculativeEntries>
+			read_buffer;
+		const auto entries_to_read = m_speculativeEntries;
+		m_RegisterInterface.readBytes(
+			Regs::FifoCount,
+			FifoCountSize + entries_to_read * FullFifoEntrySize,
+			read_buffer.data()
+		);
 
-		std::array<uint8_t, FullFifoEntrySize * MaxReadings> read_buffer;
+		const size_t fifo_bytes = read_buffer[0] | (read_buffer[1] << 8);
+		const size_t fifo_entries = fifo_bytes / FullFifoEntrySize;
+		if (fifo_entries >= m_speculativeEntries) {
+			m_speculativeEntries = std::min(fifo_entries, MaxSpeculativeEntries);
+			m_smallerReads = 0;
+		} else if (++m_smallerReads == SpeculationShrinkReads) {
+			m_speculativeEntries = std::max<size_t>(m_speculativeEntries - 1, 1);
+			m_smallerReads = 0;
+		}
+
+		size_t entries_read = 0;
+		for (; entries_read < entries_to_read; entries_read++) {
+			const auto* raw
+				= &read_buffer[FifoCountSize + entries_read * FullFifoEntrySize];
+			if (raw[0] & Regs::FifoEmptyHeader) {
+				break;
+			}
 
-		const auto bytes_to_read = std::min(
-									   static_cast<size_t>(read_buffer.size()),
-									   static_cast<size_t>(fifo_bytes)
-								   )
-								 / FullFifoEntrySize * FullFifoEntrySize;
-		m_RegisterInterface
-			.readBytes(Regs::FifoData, bytes_to_read, read_buffer.data());
-		for (auto i = 0u; i < bytes_to_read; i += FullFifoEntrySize) {
 			FifoEntryAligned entry;
-			memcpy(
-				entry.raw,
-				&read_buffer[i + 0x1],
-				sizeof(FifoEntryAligned)
-			);  // skip fifo header
+			memcpy(entry.raw, &raw[0x1], sizeof(FifoEntryAligned));  // skip fifo header
 
 			int32_t gyroData[3];
 			entry.getGyro(gyroData);
@@ -254,7 +332,7 @@ struct ICM42688 {
 				);
 			}
 		}
-		return fifo_bytes > bytes_to_read;
+		return fifo_entries > entries_read;
 	}
 };
 
@@ -35,14 +35,19 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // Gyroscope ODR = 204.8Hz, accel ODR = 102.4Hz
 // Timestamps reading not used, as they're useless (constant predefined increment)
 
-struct ICM45605 : public ICM45Base {
+template <typename RegInterface>
+struct ICM45605 : public ICM45Base<RegInterface> {
+	using Base = ICM45Base<RegInterface>;
+	using Base::m_Logger;
+	using Base::m_RegisterInterface;
+
 	static constexpr auto Name = "ICM-45605";
 	static constexpr auto Type = SensorTypeID::ICM45605;
 
 	static constexpr VQFParams SensorVQFParams{};
 
-	ICM45605(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
-		: ICM45Base{registerInterface, logger} {}
+	ICM45605(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+		: Base{registerInterface, logger} {}
 
 	struct Regs {
 		struct WhoAmI {
@@ -52,8 +57,8 @@ struct ICM45605 : public ICM45Base {
 	};
 
 	bool initialize() {
-		ICM45Base::softResetIMU();
-		return ICM45Base::initializeBase();
+		Base::softResetIMU();
+		return Base::initializeBase();
 	}
 };
 
@@ -35,14 +35,19 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // Gyroscope ODR = 204.8Hz, accel ODR = 102.4Hz
 // Timestamps reading not used, as they're useless (constant predefined increment)
 
-struct ICM45686 : public ICM45Base {
+template <typename RegInterface>
+struct ICM45686 : public ICM45Base<RegInterface> {
+	using Base = ICM45Base<RegInterface>;
+	using Base::m_Logger;
+	using Base::m_RegisterInterface;
+
 	static constexpr auto Name = "ICM-45686";
 	static constexpr auto Type = SensorTypeID::ICM45686;
 
 	static constexpr VQFParams SensorVQFParams{};
 
-	ICM45686(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
-		: ICM45Base{registerInterface, logger} {}
+	ICM45686(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+		: Base{registerInterface, logger} {}
 
 	struct Regs {
 		struct WhoAmI {
@@ -62,12 +67,12 @@ struct ICM45686 : public ICM45Base {
 	};
 
 	bool initialize() {
-		ICM45Base::softResetIMU();
+		Base::softResetIMU();
 #if IMU_USE_EXTERNAL_CLOCK
 		m_RegisterInterface.writeReg(Regs::Pin9Config::reg, Regs::Pin9Config::value);
 		m_RegisterInterface.writeReg(Regs::RtcConfig::reg, Regs::RtcConfig::value);
 #endif
-		return ICM45Base::initializeBase();
+		return Base::initializeBase();
 	}
 };
 
@@ -37,8 +37,10 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // Gyroscope ODR = 204.8Hz, accel ODR = 102.4Hz
 // Timestamps reading not used, as they're useless (constant predefined increment)
 
+template <typename RegInterface>
 struct ICM45Base {
 	static constexpr uint8_t Address = 0x68;
+	static constexpr uint32_t MaxI2CClock = 1000000;  // Fast-mode Plus
 
 	static constexpr float GyrTs = 1.0 / 204.8;
 	static constexpr float AccTs = 1.0 / 102.4;
@@ -54,9 +56,9 @@ struct ICM45Base {
 
 	static constexpr float TemperatureZROChange = 20.0f;
 
-	RegisterInterface& m_RegisterInterface;
+	RegInterface& m_RegisterInterface;
 	SlimeVR::Logging::Logger& m_Logger;
-	ICM45Base(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+	ICM45Base(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
 		: m_RegisterInterface(registerInterface)
 		, m_Logger(logger) {}
 
@@ -106,6 +108,23 @@ struct ICM45Base {
 		static constexpr uint8_t FifoCount = 0x12;
 		static constexpr uint8_t FifoData = 0x14;
 
+		struct Int1Config0 {
+			static constexpr uint8_t reg = 0x16;
+			static constexpr uint8_t value = (0b1 << 1);  // FIFO watermark on INT1
+		};
+		struct Int1Config2 {
+			static constexpr uint8_t reg = 0x18;
+			static constexpr uint8_t value
+				= 0b1 | (0b1 << 1);  // INT1 active high, latched, push-pull
+		};
+		static constexpr uint8_t Int1Status0 = 0x19;  // clears INT1 when read
+		static constexpr uint8_t FifoWatermark = 0x1e;  // in packets, 2 registers
+		struct FifoConfig2 {
+			static constexpr uint8_t reg = 0x20;
+			static constexpr uint8_t value
+				= (0b1 << 3);  // raise the watermark interrupt on every write above it
+		};
+
 		// Indirect Register Access
 
 		static constexpr uint32_t IRegWaitTimeMicros = 4;
@@ -238,9 +257,38 @@ struct ICM45Base {
 	// stack overflow and panic
 	std::vector<uint8_t> read_buffer;
 
-	bool bulkRead(DriverCallbacks<int32_t>&& callbacks) {
+	bool m_fifoInterrupt = false;
+
+	// Raises INT1 once the FIFO holds readInterval worth of packets
+	void setupFifoInterrupt(float readInterval) {
+		// One more packet than is read, see bulkRead()
+		const auto packets = std::max<size_t>(readInterval / GyrTs, 1) + 1;
+		m_RegisterInterface.writeReg16(BaseRegs::FifoWatermark, packets);
+		m_RegisterInterface.writeReg(
+			BaseRegs::FifoConfig2::reg,
+			BaseRegs::FifoConfig2::value
+		);
+		m_RegisterInterface.writeReg(
+			BaseRegs::Int1Config2::reg,
+			BaseRegs::Int1Config2::value
+		);
+		m_RegisterInterface.writeReg(
+			BaseRegs::Int1Config0::reg,
+			BaseRegs::Int1Config0::value
+		);
+		m_fifoInterrupt = true;
+	}
+
+	template <DriverCallbacksFor<int32_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
 		constexpr int16_t InvalidReading = -32768;
 
+		if (m_fifoInterrupt) {
+			// Only read to clear INT1. Latched: it comes back on the next write if the
+			// FIFO stays above the watermark
+			static_cast<void>(m_RegisterInterface.readReg(BaseRegs::Int1Status0));
+		}
+
 		size_t fifo_packets = m_RegisterInterface.readReg16(BaseRegs::FifoCount);
 
 		if (fifo_packets <= 1) {
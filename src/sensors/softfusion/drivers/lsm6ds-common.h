@@ -27,20 +27,22 @@
 #include <array>
 #include <cstdint>
 
+#include "../../../debugging/Metrics.h"
 #include "../../../sensorinterface/RegisterInterface.h"
 #include "callbacks.h"
 
 namespace SlimeVR::Sensors::SoftFusion::Drivers {
 
+template <typename RegInterface>
 struct LSM6DSOutputHandler {
 	LSM6DSOutputHandler(
-		RegisterInterface& registerInterface,
+		RegInterface& registerInterface,
 		SlimeVR::Logging::Logger& logger
 	)
 		: m_RegisterInterface(registerInterface)
 		, m_Logger(logger) {}
 
-	RegisterInterface& m_RegisterInterface;
+	RegInterface& m_RegisterInterface;
 	SlimeVR::Logging::Logger& m_Logger;
 
 #pragma pack(push, 1)
@@ -53,10 +55,36 @@ struct LSM6DSOutputHandler {
 #pragma pack(pop)
 
 	static constexpr size_t FullFifoEntrySize = sizeof(FifoEntryAligned) + 1;
+	static constexpr size_t MaxReadings = 8;
+
+	// Same on the whole family
+	struct InterruptRegs {
+		static constexpr uint8_t FifoWatermark = 0x07;  // in FIFO words
+		static constexpr size_t MaxFifoWatermark = 0xff;  // 8-bit register
+		struct Int1Ctrl {
+			static constexpr uint8_t reg = 0x0d;
+			static constexpr uint8_t value = (0b1 << 3);  // FIFO watermark on INT1
+		};
+	};
+
+	// Raises INT1 while the FIFO holds readInterval worth of words, wordRate being
+	// the sum of the batching rates. drainFifo() reads it back in several bursts
+	void setupFifoInterrupt(float readInterval, float wordRate) {
+		const auto words = std::clamp<size_t>(
+			readInterval * wordRate,
+			1,
+			InterruptRegs::MaxFifoWatermark
+		);
+		m_RegisterInterface.writeReg(InterruptRegs::FifoWatermark, words);
+		m_RegisterInterface.writeReg(
+			InterruptRegs::Int1Ctrl::reg,
+			InterruptRegs::Int1Ctrl::value
+		);
+	}
 
-	template <typename Regs>
+	template <typename Regs, DriverCallbacksFor<int16_t> Callbacks>
 	bool bulkRead(
-		DriverCallbacks<int16_t>&& callbacks,
+		Callbacks&& callbacks,
 		float GyrTs,
 		float AccTs,
 		float TempTs
@@ -72,9 +100,10 @@ struct LSM6DSOutputHandler {
 			m_Logger.error(
 				"FIFO OVERRUN! This occuring during normal usage is an issue."
 			);
+			Debugging::metrics.increment(Debugging::Counter::FifoOverruns);
 		}
 
-		std::array<uint8_t, FullFifoEntrySize * 8> read_buffer;  // max 8 readings
+		std::array<uint8_t, FullFifoEntrySize * MaxReadings> read_buffer;
 		const auto bytes_to_read = std::min(
 									   static_cast<size_t>(read_buffer.size()),
 									   static_cast<size_t>(fifo_bytes)
@@ -27,6 +27,7 @@
 #include <array>
 #include <cstdint>
 
+#include "../../../debugging/Metrics.h"
 #include "../../../sensorinterface/RegisterInterface.h"
 #include "callbacks.h"
 #include "vqf.h"
@@ -37,6 +38,7 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // and gyroscope range at 1000dps
 // Gyroscope ODR = 208Hz, accel ODR = 104Hz
 
+template <typename RegInterface>
 struct LSM6DS3TRC {
 	static constexpr uint8_t Address = 0x6a;
 	static constexpr auto Name = "LSM6DS3TR-C";
@@ -63,9 +65,9 @@ struct LSM6DS3TRC {
 
 	static constexpr VQFParams SensorVQFParams{};
 
-	RegisterInterface& m_RegisterInterface;
-	SlimeVR::Logging::Logger m_Logger;
-	LSM6DS3TRC(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+	RegInterface& m_RegisterInterface;
+	SlimeVR::Logging::Logger& m_Logger;
+	LSM6DS3TRC(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
 		: m_RegisterInterface(registerInterface)
 		, m_Logger(logger) {}
 
@@ -90,6 +92,7 @@ struct LSM6DS3TRC {
 			static constexpr uint8_t value = (1 << 6) | (1 << 2);  // BDU = 1, IF_INC =
 																   // 1
 		};
+		static constexpr uint8_t FifoCtrl1Threshold = 0x06;  // in 16 bit words
 		struct FifoCtrl2 {
 			static constexpr uint8_t reg = 0x07;
 			static constexpr uint8_t value = 0b1000;  // temperature in fifo
@@ -105,10 +108,18 @@ struct LSM6DS3TRC {
 				= 0b110 | (0b0110 << 3);  // continuous mode, odr = 416Hz
 		};
 
+		struct Int1Ctrl {
+			static constexpr uint8_t reg = 0x0d;
+			static constexpr uint8_t value = (0b1 << 3);  // FIFO threshold on INT1
+		};
+
 		static constexpr uint8_t FifoStatus = 0x3a;
 		static constexpr uint8_t FifoData = 0x3e;
 	};
 
+	static constexpr size_t SingleMeasurementWords = 6;
+	static constexpr size_t MaxReadings = 10;
+
 	bool initialize() {
 		// perform initialization step
 		m_RegisterInterface.writeReg(Regs::Ctrl3C::reg, Regs::Ctrl3C::valueSwReset);
@@ -122,22 +133,40 @@ struct LSM6DS3TRC {
 		return true;
 	}
 
-	bool bulkRead(DriverCallbacks<int16_t>&& callbacks) {
+	// Raises INT1 while the FIFO holds readInterval worth of measurements, as much
+	// as fits the low threshold byte. drainFifo() reads it back in several bursts
+	void setupFifoInterrupt(float readInterval) {
+		constexpr size_t MaxThresholdMeasurements = 0xff / SingleMeasurementWords;
+		const auto measurements = std::clamp<size_t>(
+			readInterval * GyrFreq,
+			1,
+			MaxThresholdMeasurements
+		);
+		m_RegisterInterface.writeReg(
+			Regs::FifoCtrl1Threshold,
+			static_cast<uint8_t>(measurements * SingleMeasurementWords)
+		);
+		m_RegisterInterface.writeReg(Regs::Int1Ctrl::reg, Regs::Int1Ctrl::value);
+	}
+
+	template <DriverCallbacksFor<int16_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
 		const auto read_result = m_RegisterInterface.readReg16(Regs::FifoStatus);
 		if (read_result & 0x4000) {  // overrun!
 			// disable and re-enable fifo to clear it
 			m_Logger.debug("Fifo overrun, resetting...");
+			Debugging::metrics.increment(Debugging::Counter::FifoOverruns);
 			m_RegisterInterface.writeReg(Regs::FifoCtrl5::reg, 0);
 			m_RegisterInterface.writeReg(Regs::FifoCtrl5::reg, Regs::FifoCtrl5::value);
 			return true;
 		}
 		const auto unread_entries = read_result & 0x7ff;
-		constexpr auto single_measurement_words = 6;
+		constexpr auto single_measurement_words = SingleMeasurementWords;
 		constexpr auto single_measurement_bytes
 			= sizeof(uint16_t) * single_measurement_words;
 
-		std::array<int16_t, 60>
-			read_buffer;  // max 10 packages of 6 16bit values of data form fifo
+		// max 10 packages of 6 16bit values of data form fifo
+		std::array<int16_t, SingleMeasurementWords * MaxReadings> read_buffer;
 		const auto bytes_to_read = std::min(
 									   static_cast<size_t>(read_buffer.size()),
 									   static_cast<size_t>(unread_entries)
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <utility>
 
 #include "callbacks.h"
 #include "lsm6ds-common.h"
@@ -37,7 +38,12 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // and gyroscope range at 1000dps
 // Gyroscope ODR = 416Hz, accel ODR = 104Hz
 
-struct LSM6DSO : LSM6DSOutputHandler {
+template <typename RegInterface>
+struct LSM6DSO : public LSM6DSOutputHandler<RegInterface> {
+	using Base = LSM6DSOutputHandler<RegInterface>;
+	using Base::m_Logger;
+	using Base::m_RegisterInterface;
+
 	static constexpr uint8_t Address = 0x6a;
 	static constexpr auto Name = "LSM6DSO";
 	static constexpr auto Type = SensorTypeID::LSM6DSO;
@@ -96,8 +102,8 @@ struct LSM6DSO : LSM6DSOutputHandler {
 		static constexpr uint8_t FifoData = 0x78;
 	};
 
-	LSM6DSO(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
-		: LSM6DSOutputHandler(registerInterface, logger) {}
+	LSM6DSO(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+		: Base(registerInterface, logger) {}
 
 	bool initialize() {
 		// perform initialization step
@@ -117,9 +123,14 @@ struct LSM6DSO : LSM6DSOutputHandler {
 		return true;
 	}
 
-	bool bulkRead(DriverCallbacks<int16_t>&& callbacks) {
-		return LSM6DSOutputHandler::template bulkRead<Regs>(
-			std::move(callbacks),
+	void setupFifoInterrupt(float readInterval) {
+		Base::setupFifoInterrupt(readInterval, GyrFreq + AccFreq + TempFreq);
+	}
+
+	template <DriverCallbacksFor<int16_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
+		return Base::template bulkRead<Regs>(
+			std::forward<Callbacks>(callbacks),
 			GyrTs,
 			AccTs,
 			TempTs
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <utility>
 
 #include "lsm6ds-common.h"
 
@@ -35,7 +36,12 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // and gyroscope range at 1000dps
 // Gyroscope ODR = 208Hz, accel ODR = 104Hz
 
-struct LSM6DSR : LSM6DSOutputHandler {
+template <typename RegInterface>
+struct LSM6DSR : public LSM6DSOutputHandler<RegInterface> {
+	using Base = LSM6DSOutputHandler<RegInterface>;
+	using Base::m_Logger;
+	using Base::m_RegisterInterface;
+
 	static constexpr uint8_t Address = 0x6a;
 	static constexpr auto Name = "LSM6DSR";
 	static constexpr auto Type = SensorTypeID::LSM6DSR;
@@ -94,8 +100,8 @@ struct LSM6DSR : LSM6DSOutputHandler {
 		static constexpr uint8_t FifoData = 0x78;
 	};
 
-	LSM6DSR(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
-		: LSM6DSOutputHandler(registerInterface, logger) {}
+	LSM6DSR(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+		: Base(registerInterface, logger) {}
 
 	bool initialize() {
 		// perform initialization step
@@ -115,9 +121,14 @@ struct LSM6DSR : LSM6DSOutputHandler {
 		return true;
 	}
 
-	bool bulkRead(DriverCallbacks<int16_t>&& callbacks) {
-		return LSM6DSOutputHandler::template bulkRead<Regs>(
-			std::move(callbacks),
+	void setupFifoInterrupt(float readInterval) {
+		Base::setupFifoInterrupt(readInterval, GyrFreq + AccFreq + TempFreq);
+	}
+
+	template <DriverCallbacksFor<int16_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
+		return Base::template bulkRead<Regs>(
+			std::forward<Callbacks>(callbacks),
 			GyrTs,
 			AccTs,
 			TempTs
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <utility>
 
 #include "lsm6ds-common.h"
 #include "vqf.h"
@@ -36,8 +37,14 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // and gyroscope range at 1000dps
 // Gyroscope ODR = 240Hz, accel ODR = 120Hz
 
-struct LSM6DSV : LSM6DSOutputHandler {
+template <typename RegInterface>
+struct LSM6DSV : public LSM6DSOutputHandler<RegInterface> {
+	using Base = LSM6DSOutputHandler<RegInterface>;
+	using Base::m_Logger;
+	using Base::m_RegisterInterface;
+
 	static constexpr uint8_t Address = 0x6a;
+	static constexpr uint32_t MaxI2CClock = 1000000;  // Fast-mode Plus
 	static constexpr auto Name = "LSM6DSV";
 	static constexpr auto Type = SensorTypeID::LSM6DSV;
 
@@ -107,8 +114,8 @@ struct LSM6DSV : LSM6DSOutputHandler {
 		static constexpr uint8_t FifoData = 0x78;
 	};
 
-	LSM6DSV(RegisterInterface& registerInterface, SlimeVR::Logging::Logger& logger)
-		: LSM6DSOutputHandler(registerInterface, logger) {}
+	LSM6DSV(RegInterface& registerInterface, SlimeVR::Logging::Logger& logger)
+		: Base(registerInterface, logger) {}
 
 	bool initialize() {
 		// perform initialization step
@@ -131,9 +138,14 @@ struct LSM6DSV : LSM6DSOutputHandler {
 		return true;
 	}
 
-	bool bulkRead(DriverCallbacks<int16_t>&& callbacks) {
-		return LSM6DSOutputHandler::template bulkRead<Regs>(
-			std::move(callbacks),
+	void setupFifoInterrupt(float readInterval) {
+		Base::setupFifoInterrupt(readInterval, GyrFreq + AccFreq + TempFreq);
+	}
+
+	template <DriverCallbacksFor<int16_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
+		return Base::template bulkRead<Regs>(
+			std::forward<Callbacks>(callbacks),
 			GyrTs,
 			AccTs,
 			TempTs
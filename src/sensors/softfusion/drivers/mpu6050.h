@@ -29,6 +29,7 @@
 #include <array>
 #include <cstdint>
 
+#include "../../../debugging/Metrics.h"
 #include "../../../sensorinterface/RegisterInterface.h"
 #include "callbacks.h"
 #include "vqf.h"
@@ -39,6 +40,7 @@ namespace SlimeVR::Sensors::SoftFusion::Drivers {
 // and gyroscope range at 1000dps
 // Gyroscope ODR = accel ODR = 250Hz
 
+template <typename RegInterface>
 struct MPU6050 {
 	struct FifoSample {
 		uint8_t accel_x_h, accel_x_l;
@@ -72,9 +74,9 @@ struct MPU6050 {
 
 	static constexpr VQFParams SensorVQFParams{};
 
-	RegisterInterface& m_RegisterInterface;
+	RegInterface& m_RegisterInterface;
 	SlimeVR::Logging::Logger& m_Logger;
-	MPU6050(RegisterInterface& i2c, SlimeVR::Logging::Logger& logger)
+	MPU6050(RegInterface& i2c, SlimeVR::Logging::Logger& logger)
 		: m_RegisterInterface(i2c)
 		, m_Logger(logger) {}
 
@@ -176,13 +178,15 @@ struct MPU6050 {
 		return result;
 	}
 
-	bool bulkRead(DriverCallbacks<int16_t>&& callbacks) {
+	template <DriverCallbacksFor<int16_t> Callbacks>
+	bool bulkRead(Callbacks&& callbacks) {
 		const auto status = m_RegisterInterface.readReg(Regs::IntStatus);
 
 		if (status & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) {
 			// Overflows make it so we lose track of which packet is which
 			// This necessitates a reset
 			m_Logger.debug("Fifo overrun, resetting...");
+			Debugging::metrics.increment(Debugging::Counter::FifoOverruns);
 			resetFIFO();
 			return true;
 		}
@@ -32,10 +32,12 @@
 
 template <typename IMU>
 struct IMUConsts {
-	static constexpr bool Uses32BitSensorData
-		= requires(IMU& i, DriverCallbacks<int32_t> callbacks) {
-			  i.bulkRead(std::move(callbacks));
-		  };
+	using SampleCallback32 = void (*)(const int32_t sample[3], float timestep);
+	using TempCallback = void (*)(int16_t sample, float timestep);
+	static constexpr bool Uses32BitSensorData = requires(
+		IMU& i,
+		DriverCallbacks<SampleCallback32, SampleCallback32, TempCallback> callbacks
+	) { i.bulkRead(std::move(callbacks)); };
 
 	static constexpr bool DirectTempReadOnly = requires(IMU& i) { i.getDirectTemp(); };
 
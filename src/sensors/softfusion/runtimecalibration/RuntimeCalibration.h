@@ -232,6 +232,14 @@ public:
 
 	float getZROChange() final { return activeZROChange; }
 
+	const Configuration::RuntimeCalibrationSensorConfig& getCalibration() const {
+		return calibration;
+	}
+	// Also holds the timesteps, which are measured on every boot and not saved
+	const Configuration::RuntimeCalibrationSensorConfig& getActiveCalibration() const {
+		return activeCalibration;
+	}
+
 private:
 	enum class CalibrationStepEnum {
 		NONE,
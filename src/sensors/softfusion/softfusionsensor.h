@@ -25,13 +25,18 @@
 
 #include <PinInterface.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <vector>
 
 #include "../../GlobalVars.h"
+#include "../../debugging/Metrics.h"
+#include "../../debugging/Profiler.h"
 #include "../../sensorinterface/SensorInterface.h"
 #include "../RestCalibrationDetector.h"
 #include "../sensor.h"
+#include "FifoBurstController.h"
 #include "TempGradientCalculator.h"
 #include "imuconsts.h"
 #include "motionprocessing/types.h"
@@ -40,14 +45,40 @@
 
 namespace SlimeVR::Sensors {
 
-template <typename SensorType, template <typename IMU> typename Calibrator>
+// RegInterface is the type of the register interface the driver calls into. With
+// a concrete one like I2CImpl the accessors inline into the driver, the default
+// goes through the virtual RegisterInterface
+template <
+	template <typename Interface> typename Driver,
+	template <typename IMU> typename Calibrator,
+	typename RegInterface = RegisterInterface>
 class SoftFusionSensor : public Sensor {
+	using SensorType = Driver<RegInterface>;
 	using Consts = IMUConsts<SensorType>;
 	using RawSensorT = typename Consts::RawSensorT;
 
 	using Calib = Calibrator<SensorType>;
 	static constexpr auto UpsideDownCalibrationInit = Calib::HasUpsideDownCalibration;
 
+	using ProfileScope = Debugging::ProfileScope;
+	using ProfileZone = Debugging::ProfileZone;
+
+	static constexpr float MaxSendRateHz = 100.0f;
+	static constexpr uint32_t SendIntervalMicros = 1.0f / MaxSendRateHz * 1e6f;
+	// Intervals without a watermark interrupt before falling back to polling
+	static constexpr uint32_t FifoInterruptTimeoutIntervals = 3;
+	static constexpr bool OverlappedReads = USE_OVERLAPPED_SENSOR_READS;
+	// Drivers of IMUs rated for Fast-mode Plus say so
+	static constexpr uint32_t MaxI2CClock = [] {
+		if constexpr (requires { SensorType::MaxI2CClock; }) {
+			return SensorType::MaxI2CClock;
+		} else {
+			return uint32_t{400000};
+		}
+	}();
+	// WhoAmI reads per bus check, to catch the odd corrupted byte
+	static constexpr uint8_t BusCheckReads = 16;
+
 	float lastReadTemperature = 0;
 	uint32_t lastTempPollTime = micros();
 
@@ -84,6 +115,42 @@ class SoftFusionSensor : public Sensor {
 		}
 	}
 
+	// Without an interrupt pin the FIFO is polled every send interval. Reported
+	// by motionLoop(), as this can run on the sensor reader
+	bool fifoReady(uint32_t elapsed) {
+		if (!m_fifoInterrupt || m_intPin->digitalRead() == HIGH) {
+			return true;
+		}
+		if (elapsed < SendIntervalMicros * FifoInterruptTimeoutIntervals) {
+			return false;
+		}
+
+		m_fifoInterrupt = false;
+		m_fetch.interruptTimedOut = true;
+		return true;
+	}
+
+	// Reads bursts until the FIFO is empty or the loop budget is spent, returns
+	// whether data was left behind
+	template <typename Callbacks>
+	bool drainFifo(Callbacks& callbacks) {
+		const uint32_t start = micros();
+		m_burstController.beginDrain(start);
+		uint32_t burstStart = start;
+		uint8_t bursts = 0;
+		bool overwhelmed;
+		do {
+			overwhelmed = m_sensor.bulkRead(callbacks);
+			bursts++;
+
+			const uint32_t now = micros();
+			m_burstController.recordBurst(now - burstStart);
+			burstStart = now;
+		} while (overwhelmed
+				 && m_burstController.canContinue(bursts, burstStart - start));
+		return overwhelmed;
+	}
+
 	void sendData() final {
 		Sensor::sendData();
 		sendTempIfNeeded();
@@ -114,8 +181,12 @@ class SoftFusionSensor : public Sensor {
 
 		calibrator.scaleAccelSample(accelData);
 
-		m_fusion.updateAcc(accelData, calibrator.getAccelTimestep());
+		{
+			ProfileScope scope{ProfileZone::Fusion};
+			m_fusion.updateAcc(accelData, calibrator.getAccelTimestep());
+		}
 
+		ProfileScope scope{ProfileZone::Calibration};
 		calibrator.provideAccelSample(xyz);
 	}
 
@@ -125,8 +196,13 @@ class SoftFusionSensor : public Sensor {
 			   static_cast<sensor_real_t>(xyz[1]),
 			   static_cast<sensor_real_t>(xyz[2])};
 		calibrator.scaleGyroSample(gyroData);
-		m_fusion.updateGyro(gyroData, calibrator.getGyroTimestep());
+		{
+			ProfileScope scope{ProfileZone::Fusion};
+			m_fusion.updateGyro(gyroData, calibrator.getGyroTimestep());
+		}
+		m_tpsCounter.update();
 
+		ProfileScope scope{ProfileZone::Calibration};
 		calibrator.provideGyroSample(xyz);
 	}
 
@@ -154,9 +230,12 @@ public:
 	static constexpr auto TypeID = SensorType::Type;
 	static constexpr uint8_t Address = SensorType::Address;
 
+	template <typename Interface>
+	using WithInterface = SoftFusionSensor<Driver, Calibrator, Interface>;
+
 	SoftFusionSensor(
 		uint8_t id,
-		RegisterInterface& registerInterface,
+		RegInterface& registerInterface,
 		float rotation,
 		SlimeVR::SensorInterface* sensorInterface = nullptr,
 		PinInterface* intPin = nullptr,
@@ -176,7 +255,8 @@ public:
 			  SensorType::AccTs,
 			  SensorType::MagTs
 		  )
-		, m_sensor(registerInterface, m_Logger) {}
+		, m_sensor(registerInterface, m_Logger)
+		, m_intPin(intPin) {}
 	~SoftFusionSensor() override = default;
 
 	void checkSensorTimeout() {
@@ -188,6 +268,7 @@ public:
 
 		working = false;
 		m_status = SensorStatus::SENSOR_ERROR;
+		Debugging::metrics.increment(Debugging::Counter::SensorTimeouts);
 		m_Logger.error(
 			"Sensor timeout I2C Address 0x%02x delaytime: %d ms",
 			addr,
@@ -199,12 +280,22 @@ public:
 		);
 	}
 
-	void motionLoop() final {
-		calibrator.tick();
+	[[nodiscard]] bool supportsOverlappedReads() const final {
+		return OverlappedReads;
+	}
 
-		// read fifo updating fusion
+	[[nodiscard]] bool fetchDue() const final {
+		return micros() - m_lastRotationPacketSent >= SendIntervalMicros;
+	}
+
+	// All bus access of the loop. With overlapped reads the samples are buffered
+	// for motionLoop(), as this runs on the sensor reader during another sensor's
+	// fusion, otherwise they are processed as they are read
+	void fetchSamples() final {
 		uint32_t now = micros();
 
+		m_fetch.fetched = true;
+		m_fetch.directTemp = false;
 		if constexpr (Consts::DirectTempReadOnly) {
 			uint32_t tempElapsed = now - lastTempPollTime;
 			if (tempElapsed >= Consts::DirectTempReadTs * 1e6) {
@@ -213,47 +304,157 @@ public:
 					- (tempElapsed
 					   - static_cast<uint32_t>(Consts::DirectTempReadTs * 1e6));
 				lastReadTemperature = m_sensor.getDirectTemp();
-
-				calibrator.provideTempSample(lastReadTemperature);
-
-				if (toggles.getToggle(SensorToggles::TempGradientCalibrationEnabled)) {
-					tempGradientCalculator.feedSample(
-						lastReadTemperature,
-						Consts::DirectTempReadTs
-					);
-				}
+				m_fetch.directTemp = true;
 			}
 		}
 
-		if (toggles.getToggle(SensorToggles::TempGradientCalibrationEnabled)) {
-			tempGradientCalculator.tick();
-		}
-
 		constexpr uint32_t targetPollIntervalMicros = 6000;
 		uint32_t elapsed = now - m_lastPollTime;
 		if (elapsed >= targetPollIntervalMicros) {
 			m_lastPollTime = now - (elapsed - targetPollIntervalMicros);
 		}
 
-		// send new fusion values when time is up
+		// read the fifo when it is time to send new fusion values
 		now = micros();
-		constexpr float maxSendRateHz = 100.0f;
-		constexpr uint32_t sendInterval = 1.0f / maxSendRateHz * 1e6f;
 		elapsed = now - m_lastRotationPacketSent;
-		if (elapsed >= sendInterval) {
-			auto overwhelmed = m_sensor.bulkRead({
-				[&](const auto sample[3], float AccTs) {
+		m_fetch.read = elapsed >= SendIntervalMicros && fifoReady(elapsed);
+		if (!m_fetch.read) {
+			return;
+		}
+		m_fetch.now = now;
+		m_fetch.elapsed = elapsed;
+
+		ProfileScope scope{ProfileZone::FifoParse};
+		if constexpr (OverlappedReads) {
+			m_bufferedSamples.clear();
+			using Kind = BufferedSample::Kind;
+			auto buffer = [&](Kind kind, const RawSensorT xyz[3], float timestep) {
+				auto& sample = m_bufferedSamples.emplace_back();
+				sample.kind = kind;
+				std::copy(xyz, xyz + 3, sample.xyz);
+				sample.timestep = timestep;
+			};
+			DriverCallbacks callbacks{
+				[&](const RawSensorT sample[3], float AccTs) {
+					buffer(Kind::Accel, sample, AccTs);
+				},
+				[&](const RawSensorT sample[3], float GyrTs) {
+					buffer(Kind::Gyro, sample, GyrTs);
+				},
+				[&](int16_t sample, float TempTs) {
+					const RawSensorT xyz[3] = {sample, 0, 0};
+					buffer(Kind::Temp, xyz, TempTs);
+				},
+			};
+			m_fetch.overwhelmed = drainFifo(callbacks);
+		} else {
+			DriverCallbacks callbacks{
+				[&](const RawSensorT sample[3], float AccTs) {
 					processAccelSample(sample, AccTs);
 				},
-				[&](const auto sample[3], float GyrTs) {
+				[&](const RawSensorT sample[3], float GyrTs) {
 					processGyroSample(sample, GyrTs);
 				},
 				[&](int16_t sample, float TempTs) {
 					processTempSample(sample, TempTs);
 				},
-			});
-			if (overwhelmed) {
+			};
+			m_fetch.overwhelmed = drainFifo(callbacks);
+		}
+	}
+
+	// The FIFO drain covers the long bursts, I2CClock counts their failures. It
+	// runs at setup, so the samples are dropped.
+	bool checkBus(uint32_t clockHz) final {
+		if (clockHz > MaxI2CClock) {
+			return false;
+		}
+		for (uint8_t i = 0; i < BusCheckReads; i++) {
+			if (!checkPresent(m_sensor.m_RegisterInterface)) {
+				return false;
+			}
+		}
+		DriverCallbacks callbacks{
+			[](const RawSensorT[3], float) {},
+			[](const RawSensorT[3], float) {},
+			[](int16_t, float) {},
+		};
+		m_sensor.bulkRead(callbacks);
+		return true;
+	}
+
+	void processBufferedSamples() {
+		ProfileScope scope{ProfileZone::FifoParse};
+		for (const auto& sample : m_bufferedSamples) {
+			switch (sample.kind) {
+				case BufferedSample::Kind::Accel:
+					processAccelSample(sample.xyz, sample.timestep);
+					break;
+				case BufferedSample::Kind::Gyro:
+					processGyroSample(sample.xyz, sample.timestep);
+					break;
+				case BufferedSample::Kind::Temp:
+					processTempSample(
+						static_cast<int16_t>(sample.xyz[0]),
+						sample.timestep
+					);
+					break;
+			}
+		}
+		m_bufferedSamples.clear();
+	}
+
+	void motionLoop() final {
+		{
+			ProfileScope scope{ProfileZone::Calibration};
+			calibrator.tick();
+		}
+
+		// With overlapped reads the sensor manager has already fetched the samples,
+		// unless the sensor is driven on its own, like in the native tools
+		if (!m_fetch.fetched) {
+			fetchSamples();
+		}
+		m_fetch.fetched = false;
+		if constexpr (OverlappedReads) {
+			processBufferedSamples();
+		}
+
+		if (m_fetch.interruptTimedOut) {
+			m_fetch.interruptTimedOut = false;
+			Debugging::metrics.increment(Debugging::Counter::FifoInterruptTimeouts);
+			m_Logger.warn(
+				"No FIFO interrupt on %s, falling back to polling",
+				m_intPin->toString().c_str()
+			);
+		}
+
+		if constexpr (Consts::DirectTempReadOnly) {
+			if (m_fetch.directTemp) {
+				m_fetch.directTemp = false;
+				calibrator.provideTempSample(lastReadTemperature);
+
+				if (toggles.getToggle(SensorToggles::TempGradientCalibrationEnabled)) {
+					tempGradientCalculator.feedSample(
+						lastReadTemperature,
+						Consts::DirectTempReadTs
+					);
+				}
+			}
+		}
+
+		if (toggles.getToggle(SensorToggles::TempGradientCalibrationEnabled)) {
+			tempGradientCalculator.tick();
+		}
+
+		// send new fusion values when time is up
+		if (m_fetch.read) {
+			m_fetch.read = false;
+			const uint32_t now = m_fetch.now;
+			const uint32_t elapsed = m_fetch.elapsed;
+			if (m_fetch.overwhelmed) {
 				calibrator.signalOverwhelmed();
+				Debugging::metrics.increment(Debugging::Counter::FifoOverwhelmed);
 			}
 			if (!m_fusion.isUpdated()) {
 				checkSensorTimeout();
@@ -263,13 +464,16 @@ public:
 			m_lastRotationUpdateMillis = millis();
 			m_fusion.clearUpdated();
 
-			m_lastRotationPacketSent = now - (elapsed - sendInterval);
+			// With interrupts the read follows the watermark, which is never early
+			m_lastRotationPacketSent
+				= m_fifoInterrupt ? now : now - (elapsed - SendIntervalMicros);
 
-			setFusedRotation(m_fusion.getQuaternionQuat());
+			setFusedRotation(m_fusion.getQuaternionQuat(), now);
 			setAcceleration(m_fusion.getLinearAccVec());
 			optimistic_yield(100);
 		}
 
+		ProfileScope scope{ProfileZone::Calibration};
 		if (calibrationDetector.update(m_fusion)) {
 			markRestCalibrationComplete();
 		}
@@ -328,9 +532,27 @@ public:
 
 		m_status = SensorStatus::SENSOR_OK;
 		working = true;
+		m_tpsCounter.reset();
 
 		calibrator.checkStartupCalibration();
 
+		// The timeout counts from here, not from boot
+		m_lastRotationUpdateMillis = millis();
+
+		if constexpr (requires { m_sensor.setupFifoInterrupt(0.0f); }) {
+			// Polling an expander pin costs as much bus time as polling FifoCount
+			if (m_intPin && m_intPin->isDirect()) {
+				m_intPin->pinMode(INPUT);
+				m_sensor.setupFifoInterrupt(SendIntervalMicros / 1e6f);
+				m_fifoInterrupt = true;
+				m_lastRotationPacketSent = micros();
+				m_Logger.info(
+					"Reading FIFO on watermark interrupts from %s",
+					m_intPin->toString().c_str()
+				);
+			}
+		}
+
 		if constexpr (Consts::SupportsMags) {
 			magDriver.init(
 				SoftFusion::MagInterface{
@@ -381,9 +603,35 @@ public:
 	SensorStatus m_status = SensorStatus::SENSOR_OFFLINE;
 	uint32_t m_lastPollTime = micros();
 	uint32_t m_lastRotationUpdateMillis = 0;
-	uint32_t m_lastRotationPacketSent = 0;
+	uint32_t m_lastRotationPacketSent = micros();
 	uint32_t m_lastTemperaturePacketSent = 0;
 
+	SoftFusion::FifoBurstController m_burstController;
+
+	// Left by fetchSamples() for motionLoop()
+	struct FetchState {
+		// Since the last motionLoop()
+		bool fetched = false;
+		bool read = false;
+		bool overwhelmed = false;
+		bool directTemp = false;
+		bool interruptTimedOut = false;
+		uint32_t now = 0;
+		uint32_t elapsed = 0;
+	};
+	FetchState m_fetch;
+
+	struct BufferedSample {
+		enum class Kind : uint8_t { Accel, Gyro, Temp };
+		Kind kind;
+		RawSensorT xyz[3];
+		float timestep;
+	};
+	std::vector<BufferedSample> m_bufferedSamples;
+
+	PinInterface* m_intPin;
+	bool m_fifoInterrupt = false;
+
 	RestCalibrationDetector calibrationDetector;
 
 	SoftFusion::MagDriver magDriver;
@@ -28,6 +28,11 @@
 #include "GlobalVars.h"
 #include "base64.hpp"
 #include "batterymonitor.h"
+#include "debugging/BusMonitor.h"
+#include "debugging/Memory.h"
+#include "debugging/Metrics.h"
+#include "debugging/Profiler.h"
+#include "debugging/Tracer.h"
 #include "logging/Logger.h"
 #include "utils.h"
 
@@ -36,12 +41,12 @@
 #endif
 
 #ifdef EXT_SERIAL_COMMANDS
-#define CALLBACK_SIZE 7  // Increase callback size to allow for debug commands
+#define CALLBACK_SIZE 9  // Increase callback size to allow for debug commands
 #include "i2cscan.h"
 #endif
 
 #ifndef CALLBACK_SIZE
-#define CALLBACK_SIZE 6  // Default callback size
+#define CALLBACK_SIZE 8  // Default callback size
 #endif
 
 #if defined(VENDOR_URL) && defined(VENDOR_NAME) && defined(PRODUCT_NAME) \
@@ -245,6 +250,20 @@ String getEncryptionTypeName(uint8_t type) {
 	return "UNKNOWN";
 }
 
+void printHistogram(
+	const char* name,
+	const SlimeVR::Debugging::LogHistogram& histogram
+) {
+	logger.info(
+		"[STATS] %s: %lu samples, p50 %luus, p99 %luus, max %luus",
+		name,
+		static_cast<unsigned long>(histogram.count()),
+		static_cast<unsigned long>(histogram.percentile(0.5f)),
+		static_cast<unsigned long>(histogram.percentile(0.99f)),
+		static_cast<unsigned long>(histogram.max())
+	);
+}
+
 void cmdGet(CmdParser* parser) {
 	if (parser->getParamCount() < 2) {
 		return;
@@ -334,6 +353,59 @@ void cmdGet(CmdParser* parser) {
 		}
 	}
 
+	if (parser->equalCmdParam(1, "STATS")) {
+		using SlimeVR::Debugging::Counter;
+		using SlimeVR::Debugging::Gauge;
+		using SlimeVR::Debugging::Histogram;
+		using SlimeVR::Debugging::Metrics;
+		using SlimeVR::Debugging::metrics;
+
+		for (size_t i = 0; i < Metrics::CounterCount; i++) {
+			const auto counter = static_cast<Counter>(i);
+			logger.info(
+				"[STATS] %s: %lu",
+				Metrics::name(counter),
+				static_cast<unsigned long>(metrics.get(counter))
+			);
+		}
+		for (size_t i = 0; i < Metrics::GaugeCount; i++) {
+			const auto gauge = static_cast<Gauge>(i);
+			logger.info("[STATS] %s: %.1f", Metrics::name(gauge), metrics.get(gauge));
+		}
+		for (size_t i = 0; i < Metrics::HistogramCount; i++) {
+			const auto histogram = static_cast<Histogram>(i);
+			printHistogram(Metrics::name(histogram), metrics.get(histogram));
+		}
+		for (auto& sensor : sensorManager.getSensors()) {
+			char name[24];
+			snprintf(name, sizeof(name), "sensor %d latency", sensor->getSensorId());
+			printHistogram(name, sensor->m_sendLatency);
+			logger.info(
+				"[STATS] sensor %d rate: %.1f",
+				sensor->getSensorId(),
+				sensor->m_tpsCounter.getAveragedTPS()
+			);
+		}
+	}
+
+	if (parser->equalCmdParam(1, "BUS")) {
+		using SlimeVR::Debugging::busMonitor;
+
+		if (parser->getParamCount() > 2 && parser->equalCmdParam(2, "OFF")) {
+			busMonitor.setEnabled(false);
+			logger.info("[BUS] Monitoring stopped");
+		} else if (!busMonitor.isEnabled()) {
+			busMonitor.setEnabled(true);
+			logger.info("[BUS] Monitoring started, GET BUS again for the usage");
+		} else {
+			busMonitor.print();
+		}
+	}
+
+	if (parser->equalCmdParam(1, "MEMORY")) {
+		SlimeVR::Debugging::memoryMonitor.print();
+	}
+
 	if (parser->equalCmdParam(1, "WIFISCAN")) {
 		logger.info("[WSCAN] Scanning for WiFi networks...");
 
@@ -451,6 +523,61 @@ void cmdDeleteCalibration(CmdParser* parser) {
 	configuration.eraseSensors();
 }
 
+void cmdProfiler(CmdParser* parser) {
+	using SlimeVR::Debugging::profiler;
+
+	if (parser->getParamCount() > 1) {
+		if (parser->equalCmdParam(1, "ON")) {
+			profiler.setEnabled(true);
+			logger.info("CMD PROF OK: Profiler enabled");
+			return;
+		} else if (parser->equalCmdParam(1, "OFF")) {
+			profiler.setEnabled(false);
+			logger.info("CMD PROF OK: Profiler disabled");
+			return;
+		}
+	} else if (profiler.isEnabled()) {
+		profiler.print();
+		profiler.reset();
+		return;
+	}
+
+	logger.info("Usage:");
+	logger.info("  PROF ON: start measuring the time taken by the firmware");
+	logger.info("  PROF: print what was measured since the last PROF and reset it");
+	logger.info("  PROF OFF: stop measuring");
+}
+
+void cmdTrace(CmdParser* parser) {
+	using SlimeVR::Debugging::tracer;
+
+	if (parser->getParamCount() > 1) {
+		if (parser->equalCmdParam(1, "ON")) {
+			if (tracer.start()) {
+				logger.info("CMD TRACE OK: Tracing started");
+			} else {
+				logger.error("CMD TRACE ERROR: Not enough memory for the trace");
+			}
+			return;
+		} else if (parser->equalCmdParam(1, "OFF")) {
+			tracer.stop();
+			logger.info("CMD TRACE OK: Tracing stopped");
+			return;
+		} else if (parser->equalCmdParam(1, "DUMP")) {
+			tracer.dump(Serial);
+			return;
+		}
+	}
+
+	logger.info("Usage:");
+	logger.info("  TRACE ON: start recording when the firmware enters and exits zones");
+	logger.info("  TRACE OFF: stop recording");
+	logger.info(
+		"  TRACE DUMP: stop recording and print the trace in binary, for "
+		"scripts/trace_to_chrome.py"
+	);
+}
+
 #if EXT_SERIAL_COMMANDS
 void cmdScanI2C(CmdParser* parser) {
 	logger.info("Forcing I2C scan...");
@@ -465,6 +592,8 @@ void setUp() {
 	cmdCallbacks.addCmd("REBOOT", &cmdReboot);
 	cmdCallbacks.addCmd("DELCAL", &cmdDeleteCalibration);
 	cmdCallbacks.addCmd("TCAL", &cmdTemperatureCalibration);
+	cmdCallbacks.addCmd("PROF", &cmdProfiler);
+	cmdCallbacks.addCmd("TRACE", &cmdTrace);
 #if EXT_SERIAL_COMMANDS
 	cmdCallbacks.addCmd("SCANI2C", &cmdScanI2C);
 #endif
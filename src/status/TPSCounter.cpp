@@ -23,24 +23,25 @@
 #include "TPSCounter.h"
 
 void TPSCounter::reset() {
-	_lastUpdate = _lastAverageUpdate = millis();
+	_lastUpdate = _lastAverageUpdate = micros();
 	_tps = _averagedTps = 0.0;
 	_averageUpdatesCounter = 0;
 }
 
-void TPSCounter::update() {
-	long time = millis();
-	long sinceLastUpdate = millis() - _lastUpdate;
-	long sinceAvgLastUpdate = millis() - _lastAverageUpdate;
+uint32_t TPSCounter::update() {
+	uint32_t time = micros();
+	uint32_t sinceLastUpdate = time - _lastUpdate;
+	uint32_t sinceAvgLastUpdate = time - _lastAverageUpdate;
 	_lastUpdate = time;
-	_tps = 1000.0 / static_cast<float>(sinceLastUpdate);
-	if (sinceAvgLastUpdate > 1000) {
+	_tps = 1e6f / static_cast<float>(sinceLastUpdate);
+	if (sinceAvgLastUpdate > 1000000) {
 		_lastAverageUpdate = time;
 		_averagedTps
-			= 1000.0 / static_cast<float>(sinceAvgLastUpdate) * _averageUpdatesCounter;
+			= 1e6f / static_cast<float>(sinceAvgLastUpdate) * _averageUpdatesCounter;
 		_averageUpdatesCounter = 0;
 	}
 	_averageUpdatesCounter++;
+	return sinceLastUpdate;
 }
 
 float TPSCounter::getAveragedTPS() { return _averagedTps; }
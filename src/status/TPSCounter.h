@@ -28,13 +28,14 @@
 class TPSCounter {
 public:
 	void reset();
-	void update();
+	// Returns the time since the previous update, in microseconds
+	uint32_t update();
 	float getAveragedTPS();
 	float getTPS();
 
 private:
-	long _lastUpdate;
-	long _lastAverageUpdate;
+	uint32_t _lastUpdate;
+	uint32_t _lastAverageUpdate;
 	uint32_t _averageUpdatesCounter;
 	float _averagedTps;
 	float _tps;